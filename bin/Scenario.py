@@ -0,0 +1,175 @@
+#!/usr/bin/env python
+# encoding: utf-8
+""" Declarative initial conditions for HFO trials, and curricula over them.
+
+A scenario file is JSON:
+
+  {"scenarios": {NAME: SCENARIO, ...},
+   "curriculum": [STAGE, ...]}
+
+A SCENARIO may contain:
+
+  "ball":       {"x": X, "y": Y, "vx": VX, "vy": VY}
+  "offense":    [PLAYER, ...]
+  "defense":    [PLAYER, ...]
+  "possession": {"team": "offense" or "defense", "player": INDEX}
+  "recover":    true to give every player full stamina
+
+where a PLAYER is {"x": X, "y": Y, "vx": VX, "vy": VY, "body": DEG}. The
+i-th PLAYER of a team places the player with the i-th lowest uniform
+number of that team in the game; players without an entry, like
+unspecified keys, keep the position the server gave them. Positions are
+normalized as the --ball-x-min/--ball-y-min options of bin/HFO: x in
+[0,1] from the center line to the goal line the offense attacks, y in
+[-1,1]. Velocities are in meters per cycle and directions in degrees.
+Any number may be given as a [min, max] pair instead, to be drawn
+uniformly for each trial. "possession" puts the ball, at rest, right in
+front of the given player.
+
+A STAGE is {"scenarios": {NAME: WEIGHT, ...}, "trials": N} and draws the
+scenario of each of its trials by weight; "scenario": NAME is short for
+a single scenario. The stage ends after N trials, or earlier if it sets
+"goal_rate": R and the offense scored in a fraction R of the last
+"window" (default 50) trials. The last stage never ends. Without a
+curriculum, scenarios are drawn uniformly.
+"""
+
+import json, math, random
+
+# Half of the pitch length and width, in meters
+PITCH_HALF_LENGTH = 52.5
+PITCH_HALF_WIDTH = 34.0
+# Distance in front of a player where "possession" puts the ball
+POSSESSION_DIST = 0.5
+
+def _sample(value, rng):
+  """ A number, or a number drawn uniformly from a [min, max] pair. """
+  if isinstance(value, (list, tuple)):
+    low, high = value
+    return rng.uniform(float(low), float(high))
+  return float(value)
+
+class Scenario(object):
+  """ Initial conditions of a trial. """
+  def __init__(self, name, spec):
+    self._name = name
+    self._ball = spec.get('ball', {})
+    self._offense = spec.get('offense', [])
+    self._defense = spec.get('defense', [])
+    self._possession = spec.get('possession')
+    self._recover = spec.get('recover', False)
+    if self._possession is not None:
+      team = self._possession.get('team', 'offense')
+      players = self._offense if team == 'offense' else self._defense
+      assert team in ('offense', 'defense'), \
+        'Scenario %s: unknown possession team %s' % (name, team)
+      index = self._possession.get('player', 0)
+      assert index < len(players) and 'x' in players[index] and \
+        'y' in players[index], \
+        'Scenario %s: the player with possession has no position' % name
+
+  def name(self):
+    return self._name
+
+  def _place(self, spec, rng):
+    """ Draws the entries of spec, in field coordinates. """
+    place = {}
+    if 'x' in spec:
+      place['x'] = _sample(spec['x'], rng) * PITCH_HALF_LENGTH
+    if 'y' in spec:
+      place['y'] = _sample(spec['y'], rng) * PITCH_HALF_WIDTH
+    for key in ('vx', 'vy', 'body'):
+      if key in spec:
+        place[key] = _sample(spec[key], rng)
+    return place
+
+  def commands(self, offense, defense, rng):
+    """ Returns the trainer commands setting up a trial. offense and
+    defense are the (team name, sorted uniform numbers) of the teams. """
+    cmds = []
+    places = {}
+    for (team, unums), specs in ((offense, self._offense),
+                                 (defense, self._defense)):
+      for unum, spec in zip(unums, specs):
+        place = self._place(spec, rng)
+        places[(team, unum)] = place
+        if 'x' not in place or 'y' not in place:
+          continue
+        cmd = '(move (player %s %d) %f %f' % (team, unum, place['x'], place['y'])
+        if 'body' in place or 'vx' in place or 'vy' in place:
+          cmd += ' %f %f %f' % (place.get('body', 0), place.get('vx', 0),
+                                place.get('vy', 0))
+        cmds.append(cmd + ')')
+    ball = self._place(self._ball, rng)
+    if self._possession is not None:
+      team, unums = offense if self._possession.get('team', 'offense') == \
+                    'offense' else defense
+      index = self._possession.get('player', 0)
+      if index < len(unums):
+        place = places[(team, unums[index])]
+        direction = math.radians(place.get('body', 0))
+        ball = {'x': place['x'] + POSSESSION_DIST * math.cos(direction),
+                'y': place['y'] + POSSESSION_DIST * math.sin(direction)}
+    if 'x' in ball and 'y' in ball:
+      cmds.append('(move (ball) %f %f 0 %f %f)' % (ball['x'], ball['y'],
+                                                   ball.get('vx', 0),
+                                                   ball.get('vy', 0)))
+    if self._recover:
+      cmds.append('(recover)')
+    return cmds
+
+class Curriculum(object):
+  """ Chooses the scenario of each trial. """
+  def __init__(self, path, seed=None):
+    with open(path) as f:
+      spec = json.load(f)
+    self._scenarios = dict((name, Scenario(name, s))
+                           for name, s in spec['scenarios'].items())
+    assert self._scenarios, 'No scenario in %s' % path
+    self._stages = spec.get('curriculum') or \
+                   [{'scenarios': dict((name, 1) for name in self._scenarios)}]
+    for stage in self._stages:
+      if 'scenario' in stage:
+        stage['scenarios'] = {stage['scenario']: 1}
+      for name in stage['scenarios']:
+        assert name in self._scenarios, 'Unknown scenario %s in %s' % (name, path)
+    self._rng = random.Random(seed)
+    self._stage = 0
+    self._stageTrials = 0
+    self._goals = [] # Whether the offense scored, for the trials of this stage
+
+  def stage(self):
+    return self._stage
+
+  def nextScenario(self):
+    """ Draws the scenario of the next trial. """
+    weights = self._stages[self._stage]['scenarios']
+    names = sorted(weights)
+    pick = self._rng.uniform(0, sum(weights[n] for n in names))
+    for name in names:
+      pick -= weights[name]
+      if pick <= 0:
+        break
+    return self._scenarios[name]
+
+  def commands(self, scenario, offense, defense):
+    """ Returns the trainer commands setting up scenario. """
+    return scenario.commands(offense, defense, self._rng)
+
+  def endTrial(self, goal):
+    """ Records the outcome of a trial; returns True if it ends the stage. """
+    if self._stage + 1 >= len(self._stages):
+      return False
+    stage = self._stages[self._stage]
+    self._stageTrials += 1
+    self._goals.append(goal)
+    window = stage.get('window', 50)
+    recent = self._goals[-window:]
+    if self._stageTrials >= stage.get('trials', float('inf')) or \
+       ('goal_rate' in stage and len(recent) >= window and
+        sum(recent) >= stage['goal_rate'] * window):
+      self._stage += 1
+      self._stageTrials = 0
+      self._goals = []
+      return True
+    return False
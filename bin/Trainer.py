@@ -1,7 +1,8 @@
 #!/usr/bin/env python
 # encoding: utf-8
 
-import sys, numpy, time, os, subprocess, Teams
+import sys, numpy, time, os, subprocess, socket, json, Teams
+from Scenario import Curriculum
 from Communicator import ClientCommunicator, TimeoutError
 
 class DoneError(Exception):
@@ -49,6 +50,23 @@ class Trainer(object):
     self._agentPopen = [] # Agent's processes
     self._npcPopen = [] # NPC's processes
     self._connectedPlayers = [] # List of connected players
+    self._lookBody = None # Last answer to (look), None while waiting
+    # =============== SNAPSHOTS =============== #
+    self._snapshots = [] # Saved game states by snapshot id, None once dropped
+    self._stateRequests = {} # (team, unum) -> (last request, its answer)
+    # =============== SCENARIOS =============== #
+    self._curriculum = None # Chooses the initial conditions of each trial
+    if args.scenarioFile:
+      self._curriculum = Curriculum(args.scenarioFile,
+                                    args.seed if args.seed >= 0 else None)
+    self._scenarioPending = True # Set up the next trial when it starts
+    # =============== LIVE STATS =============== #
+    self._statsSocket = args.statsSocket # Unix socket of bin/aggregate_stats.py
+    self._statsInterval = args.statsInterval # Seconds between stats messages
+    self._statsSock = None
+    self._lastStats = None # (time, frame, trials) of the last stats message
+    self._frameTime = None # When the current frame began
+    self._maxFrameTime = 0 # Longest frame since the last stats message
     self.initMsgHandlers()
 
   def launch_agent(self, agent_num, agent_ext_num, play_offense, port, wait_until_join=True):
@@ -160,6 +178,11 @@ class Trainer(object):
     """ Handles hear messages from referee. """
     assert body[0] == 'referee', 'Expected referee message.'
     _,ts,event = body
+    if int(ts) != self._frame:
+      now = time.time()
+      if self._frameTime is not None:
+        self._maxFrameTime = max(self._maxFrameTime, now - self._frameTime)
+      self._frameTime = now
     self._frame = int(ts)
     endOfTrial = False
     if 'GOAL' in event:
@@ -177,6 +200,8 @@ class Trainer(object):
       endOfTrial = True
     elif event == 'HFO_FINISHED':
       self._done = True
+    elif event.startswith('IN_GAME') and self._scenarioPending:
+      self.startScenario()
     if endOfTrial:
       self._numTrials += 1
       print('EndOfTrial: %d / %d %d %s'%\
@@ -184,6 +209,26 @@ class Trainer(object):
       self._numFrames += self._frame - self._lastTrialStart
       self._lastTrialStart = self._frame
       self.getConnectedPlayers()
+      if self._curriculum is not None and \
+         self._curriculum.endTrial('GOAL' in event):
+        print('Curriculum stage %d' % self._curriculum.stage())
+      self._scenarioPending = True
+
+  def startScenario(self):
+    """ Moves the ball and players into the next scenario of the
+    curriculum, on the first cycle of a trial. """
+    self._scenarioPending = False
+    if self._curriculum is None:
+      return
+    def unums(team):
+      return (team, sorted(int(num) for t, num in self._connectedPlayers
+                           if t == team))
+    scenario = self._curriculum.nextScenario()
+    print('Scenario: %s' % scenario.name())
+    for cmd in self._curriculum.commands(scenario,
+                                         unums(self._offenseTeamName),
+                                         unums(self._defenseTeamName)):
+      self.send(cmd)
 
   def _hear(self, body):
     """ Handle a hear message. """
@@ -193,6 +238,11 @@ class Trainer(object):
     timestep,playerInfo,msg = body
     try:
       _,team,player = playerInfo[:3]
+    except:
+      return
+    if self._handleStateRequest(team, player, msg):
+      return
+    try:
       length = int(msg[0])
     except:
       return
@@ -210,6 +260,78 @@ class Trainer(object):
     else:
       print('Unhandled message from agent: %s' % msg)
 
+  def _handleStateRequest(self, team, player, msg):
+    """ Handles the snapshot requests of HFOEnvironment::saveState(),
+    'sv<seq>', HFOEnvironment::restoreState(), 'ld<seq> <id>', and
+    HFOEnvironment::dropState(), 'dr<seq> <id>'. Agents repeat a request
+    until answered, so a repeat gets the same answer again instead of
+    being carried out twice. """
+    if not isinstance(msg, str) or msg[:2] not in ('sv', 'ld', 'dr'):
+      return False
+    fields = msg[2:].split()
+    try:
+      seq = int(fields[0])
+      snapshot_id = int(fields[1]) if msg[:2] != 'sv' else None
+    except (IndexError, ValueError):
+      return False
+    last = self._stateRequests.get((team, player))
+    if last is not None and last[0] == msg:
+      self.send(last[1])
+      return True
+    if snapshot_id is None:
+      self._snapshots.append(self.saveState())
+      answer = 'HFO_SAVED %d' % (len(self._snapshots) - 1)
+    elif msg.startswith('dr'):
+      dropped = self.dropState(snapshot_id)
+      answer = 'HFO_DROPPED %d' % (snapshot_id if dropped else -1)
+    else:
+      restored = self.restoreState(snapshot_id)
+      answer = 'HFO_RESTORED %d' % (snapshot_id if restored else -1)
+    reply = '(say %s %s %s %d)' % (answer, team, player, seq)
+    self._stateRequests[(team, player)] = (msg, reply)
+    self.send(reply)
+    return True
+
+  def saveState(self):
+    """ Returns the position, velocity and body direction of the ball
+    and of each player, as reported by the server. """
+    body = self._look()
+    _,bx,by,bvx,bvy = body[3][:5]
+    ball = tuple(float(v) for v in (bx, by, bvx, bvy))
+    players = []
+    for i in range(4, len(body)):
+      team,num = body[i][0][1:3]
+      x,y,vx,vy,direction = (float(v) for v in body[i][1:6])
+      players.append((team, num, x, y, vx, vy, direction))
+    return ball, players
+
+  def restoreState(self, snapshot_id):
+    """ Moves the ball and the connected players of a snapshot back to
+    their saved state, all within the current cycle, and gives every
+    player full stamina. Returns False if the snapshot is unknown. """
+    if not self._hasSnapshot(snapshot_id):
+      return False
+    ball, players = self._snapshots[snapshot_id]
+    self.send('(move (ball) %f %f 0 %f %f)' % ball)
+    for team, num, x, y, vx, vy, direction in players:
+      if (team, num) in self._connectedPlayers:
+        self.send('(move (player %s %s) %f %f %f %f %f)'
+                  % (team, num, x, y, direction, vx, vy))
+    self.send('(recover)')
+    return True
+
+  def dropState(self, snapshot_id):
+    """ Frees a snapshot; its id is not reused. Returns False if the
+    snapshot is unknown. """
+    if not self._hasSnapshot(snapshot_id):
+      return False
+    self._snapshots[snapshot_id] = None
+    return True
+
+  def _hasSnapshot(self, snapshot_id):
+    return (0 <= snapshot_id < len(self._snapshots) and
+            self._snapshots[snapshot_id] is not None)
+
   def initMsgHandlers(self):
     """ Create handlers for different messages. """
     self._msgHandlers = []
@@ -311,23 +433,32 @@ class Trainer(object):
       self.getConnectedPlayers()
     player.kill()
 
-  def getConnectedPlayers(self):
-    """ Get the list of connected players. Populates self._connectedPlayers. """
-    self._gotLook = False
+  def _look(self):
+    """ Returns the body of the server's answer to (look): the time, both
+    goals, the ball, then one entry per player. Handlers may call it while
+    a look is pending (e.g. a referee message heard during saveState); the
+    answer is shared through self._lookBody, so both calls return. """
+    self._lookBody = None
     self.send('(look)')
     partial = ['ok','look']
     def f(body):
-      self._gotLook = True
-      del self._connectedPlayers[:]
-      for i in range(4, len(body)):
-        _,team,num = body[i][0][:3]
-        if (team, num) not in self._connectedPlayers:
-          self._connectedPlayers.append((team,num))
+      self._lookBody = body
     self.registerMsgHandler(f,*partial,quiet=True)
-    while not self._gotLook:
+    while self._lookBody is None:
       self.listenAndProcess()
-      self.send('(look)')
+      if self._lookBody is None:
+        self.send('(look)')
     self.ignoreMsg(*partial,quiet=True)
+    return self._lookBody
+
+  def getConnectedPlayers(self):
+    """ Get the list of connected players. Populates self._connectedPlayers. """
+    body = self._look()
+    del self._connectedPlayers[:]
+    for i in range(4, len(body)):
+      _,team,num = body[i][0][:3]
+      if (team, num) not in self._connectedPlayers:
+        self._connectedPlayers.append((team,num))
 
   def waitOnPlayer(self, player_num, on_offense):
     """ Wait on a launched player to connect and be reported by the server. """
@@ -367,6 +498,46 @@ class Trainer(object):
     print('Balls Out of Bounds: %i' % self._numBallsOOB)
     print('Out of Time        : %i' % self._numOutOfTime)
 
+  def publishStats(self):
+    """ Sends the counters of this game, and its rates since the last
+    call, to the stats socket every self._statsInterval seconds. The
+    sends never block: the stats are dropped if nobody listens. """
+    if not self._statsSocket:
+      return
+    now = time.time()
+    if self._lastStats is None:
+      self._lastStats = (now, self._frame, self._numTrials)
+      self._statsSock = socket.socket(socket.AF_UNIX, socket.SOCK_DGRAM)
+      self._statsSock.setblocking(False)
+      return
+    last_time, last_frame, last_trials = self._lastStats
+    elapsed = now - last_time
+    if elapsed < self._statsInterval:
+      return
+    stats = {
+      'port': self._serverPort,
+      'time': now,
+      'frames': self._numFrames,
+      'trials': self._numTrials,
+      'goals': self._numGoals,
+      'captured': self._numBallsCaptured,
+      'out_of_bounds': self._numBallsOOB,
+      'out_of_time': self._numOutOfTime,
+      'cycles_per_sec': (self._frame - last_frame) / elapsed,
+      'trials_per_sec': (self._numTrials - last_trials) / elapsed,
+      'goal_rate': self._numGoals / float(self._numTrials) if self._numTrials else 0.,
+      'avg_frames_per_trial':
+        self._numFrames / float(self._numTrials) if self._numTrials else 0.,
+      # In synch mode the slowest agent's step bounds the cycle time
+      'max_cycle_msec': self._maxFrameTime * 1000.,
+    }
+    try:
+      self._statsSock.sendto(json.dumps(stats).encode(), self._statsSocket)
+    except socket.error:
+      pass
+    self._lastStats = (now, self._frame, self._numTrials)
+    self._maxFrameTime = 0
+
   def checkLive(self, necProcesses):
     """Returns true if each of the necessary processes is still alive and
     running.
@@ -440,6 +611,7 @@ class Trainer(object):
       while self.allPlayersConnected() and self.checkLive(necProcesses) and not self._done:
         prevFrame = self._frame
         self.listenAndProcess()
+        self.publishStats()
     except TimeoutError:
       print('Haven\'t heard from the server for too long, Exiting')
     except (KeyboardInterrupt, DoneError):
@@ -464,4 +636,6 @@ class Trainer(object):
         except:
           pass
       self._comm.close()
+      if self._statsSock is not None:
+        self._statsSock.close()
       self.printStats()
@@ -0,0 +1,107 @@
+#!/usr/bin/env python
+# encoding: utf-8
+""" Rolls up the live stats of the HFO games running on this host.
+
+Start it, then start each game with the same socket:
+
+  > ./bin/aggregate_stats.py --socket /tmp/hfo_stats
+  > ./bin/HFO --stats-socket /tmp/hfo_stats ...
+
+Every interval it prints the latest stats of each game, one line per
+server port, followed by their total. Games that stopped sending are
+dropped after a while.
+"""
+from __future__ import print_function
+
+import argparse, json, os, select, signal, socket, sys, time
+
+# Columns: (title, stats key, format)
+COLUMNS = [
+  ('port', 'port', '%6d'),
+  ('cycles/s', 'cycles_per_sec', '%9.1f'),
+  ('trials/s', 'trials_per_sec', '%9.3f'),
+  ('trials', 'trials', '%8d'),
+  ('goals', 'goals', '%7d'),
+  ('goal%', 'goal_rate', '%6.1f'),
+  ('frames/trial', 'avg_frames_per_trial', '%13.1f'),
+  ('max cycle ms', 'max_cycle_msec', '%13.1f'),
+]
+
+def rollUp(games):
+  """ Sums the counters and rates of games; rates of totals are recomputed. """
+  total = dict((key, 0) for _, key, _ in COLUMNS)
+  frames = 0
+  for stats in games:
+    for key in ('cycles_per_sec', 'trials_per_sec', 'trials', 'goals'):
+      total[key] += stats[key]
+    frames += stats['frames']
+    total['max_cycle_msec'] = max(total['max_cycle_msec'], stats['max_cycle_msec'])
+  if total['trials'] > 0:
+    total['goal_rate'] = total['goals'] / float(total['trials'])
+    total['avg_frames_per_trial'] = frames / float(total['trials'])
+  return total
+
+def width(title, fmt):
+  return max(len(title), len(fmt % 0))
+
+def formatHeader():
+  return ' '.join(title.rjust(width(title, fmt)) for title, _, fmt in COLUMNS)
+
+def formatRow(stats, port=None):
+  cells = []
+  for title, key, fmt in COLUMNS:
+    value = stats[key] * 100 if key == 'goal_rate' else stats[key]
+    cell = port if key == 'port' and port is not None else fmt % value
+    cells.append(cell.rjust(width(title, fmt)))
+  return ' '.join(cells)
+
+def main(args):
+  if os.path.exists(args.socket):
+    os.remove(args.socket)
+  sock = socket.socket(socket.AF_UNIX, socket.SOCK_DGRAM)
+  sock.bind(args.socket)
+  signal.signal(signal.SIGTERM, lambda signum, frame: sys.exit(0))
+  games = {} # port -> latest stats
+  next_print = time.time() + args.interval
+  try:
+    while True:
+      ready, _, _ = select.select([sock], [], [], max(0, next_print - time.time()))
+      if ready:
+        msg = sock.recv(65536)
+        try:
+          stats = json.loads(msg.decode())
+          games[stats['port']] = stats
+        except (ValueError, KeyError):
+          print('Ignoring malformed stats message')
+      if time.time() < next_print:
+        continue
+      next_print += args.interval
+      now = time.time()
+      for port in [p for p, s in games.items() if now - s['time'] > args.stale]:
+        del games[port]
+      print(time.strftime('%H:%M:%S'), '%d games' % len(games))
+      print(formatHeader())
+      if args.per_game:
+        for port in sorted(games):
+          print(formatRow(games[port]))
+      print(formatRow(rollUp(games.values()), port='total'))
+  except KeyboardInterrupt:
+    pass
+  finally:
+    sock.close()
+    os.remove(args.socket)
+
+def parseArgs():
+  p = argparse.ArgumentParser(description='Roll up live HFO game stats.')
+  p.add_argument('--socket', dest='socket', type=str, default='/tmp/hfo_stats',
+                 help='Unix socket the games send to. Default: /tmp/hfo_stats.')
+  p.add_argument('--interval', dest='interval', type=float, default=5.0,
+                 help='Seconds between reports. Default: 5.')
+  p.add_argument('--stale', dest='stale', type=float, default=30.0,
+                 help='Drop games silent for this many seconds. Default: 30.')
+  p.add_argument('--totals-only', dest='per_game', action='store_false',
+                 default=True, help='Only print the total of all games.')
+  return p.parse_args()
+
+if __name__ == '__main__':
+  main(parseArgs())
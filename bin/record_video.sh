@@ -9,7 +9,15 @@ fi
 LOG=$1
 OUT=$2
 START_FRAME=0
+RCG_RENDER="./bin/rcg_render"
 SOCCERWINDOW="./bin/soccerwindow2"
+
+# Rendered headless, frames piped straight to the encoder. Use
+# rcg_render -j N -d DIR directly to record many logs in parallel.
+if [ -x $RCG_RENDER ]; then
+    exec $RCG_RENDER -j 1 -s 1024x768 -r 10 -o $OUT $LOG
+fi
+
 DIR=`mktemp -d`
 
 $SOCCERWINDOW -l $LOG --auto-image-save --canvas-size=1920x1200 --image-save-dir=$DIR
@@ -0,0 +1,70 @@
+#ifndef DEFENSE_FEATURES_H
+#define DEFENSE_FEATURES_H
+
+#include <vector>
+#include <HFO.hpp>
+
+// Features and actions of the defense SARSA agents, shared by
+// high_level_sarsa_defense_agent and high_level_sarsa_multi_agent
+
+namespace defense {
+
+// Number of features kept by purgeFeatures
+inline int numFeatures(int numTMates, int numOpponents, bool oppPres) {
+  return oppPres ? (8 + 3 * numTMates + 2 * numOpponents) : (3 + 3 * numTMates);
+}
+
+// Number of actions: DEF_GOAL, MOVE, GO_TO_BALL, NOOP, REDUCE_ANGLE_TO_GOAL
+// and a MARK_PLAYER of each opponent
+inline int numActions(int numOpponents) {
+  return 5 + numOpponents;
+}
+
+// Fill state with only the required features from state_vec
+inline void purgeFeatures(double *state, const std::vector<float>& state_vec,
+                          int numTMates, int numOpponents, bool oppPres) {
+
+  int stateIndex = 0;
+
+  // Features[0 - 9] - {5,8}=8
+  // Features[9+T+1 - 9+2T]: teammates dists to closest opps=T
+  // Features [9+3T+1 - 9+6T]: x, y, unum of teammates ignoring %3 -> unum of team mates=2T
+  // Features  [9+6T+1 - 9+6T+3*O]: x, y, unum of opponents ignoring %3 -> unum of opponents=20
+  // Ignored: Feature [ 9+6T+3O+1, 9+6T+3O+2]: last_action_status,stamina->2 
+
+  // If no opponents ignore features Distance to Opponent
+  // and Distance from Teammate i to Opponent are absent
+  int tmpIndex = oppPres ? (9 + 3 * numTMates) : (9 + 2 * numTMates);
+
+  for(int i = 0; i < state_vec.size()-2; i++) {
+
+    // Ignore first six featues
+    if(i == 5 || i==8) continue;
+    if(i>9 && i<= 9+numTMates) continue; // Ignore Goal Opening angles, as invalid
+    if(i<= 9+3*numTMates && i > 9+2*numTMates) continue; // Ignore Pass Opening angles, as invalid
+    // Ignore Uniform Number of Teammates and opponents
+    int temp =  i-tmpIndex;
+    if(temp > 0 && (temp % 3 == 0) )continue;
+    //if (i > 9+6*numTMates) continue;
+    state[stateIndex] = state_vec[i];
+    stateIndex++;
+  }
+}
+
+// Convert int to hfo::Action
+inline hfo::action_t toAction(int action, const std::vector<float>& state_vec) {
+hfo::action_t a;
+  switch (action) {
+        case 0: a = hfo::MOVE; break;
+        case 1: a = hfo::REDUCE_ANGLE_TO_GOAL; break;
+        case 2: a = hfo::GO_TO_BALL; break;
+        case 3: a = hfo::NOOP; break;
+        case 4: a = hfo::DEFEND_GOAL; break;
+        default : a = hfo::MARK_PLAYER; break;
+  }
+    return a;
+}
+
+} // namespace defense
+
+#endif
@@ -5,8 +5,11 @@
 #include <thread>
 #include "SarsaAgent.h"
 #include "CMAC.h"
+#include "defense_features.h"
 #include <unistd.h>
 
+using namespace defense;
+
 // Before running this program, first Start HFO server:
 // $./bin/HFO --offense-agents numAgents
 
@@ -32,68 +35,13 @@ void printUsage() {
   std::cout<<"  --help                   Displays this help and exit"<<std::endl;
 }
 
-// Returns the reward for SARSA based on current state
-double getReward(hfo::status_t status) {
-  double reward;
-  if (status==hfo::GOAL) reward = -1;
-  else if (status==hfo::CAPTURED_BY_DEFENSE) reward = 1;
-  else if (status==hfo::OUT_OF_BOUNDS) reward = 1;
-  else reward = 0;
-  return reward;
-}
-
-// Fill state with only the required features from state_vec
-void purgeFeatures(double *state, const std::vector<float>& state_vec,
-                   int numTMates, int numOpponents, bool oppPres) {
-
-  int stateIndex = 0;
-
-  // Features[0 - 9] - {5,8}=8
-  // Features[9+T+1 - 9+2T]: teammates dists to closest opps=T
-  // Features [9+3T+1 - 9+6T]: x, y, unum of teammates ignoring %3 -> unum of team mates=2T
-  // Features  [9+6T+1 - 9+6T+3*O]: x, y, unum of opponents ignoring %3 -> unum of opponents=20
-  // Ignored: Feature [ 9+6T+3O+1, 9+6T+3O+2]: last_action_status,stamina->2 
-
-  // If no opponents ignore features Distance to Opponent
-  // and Distance from Teammate i to Opponent are absent
-  int tmpIndex = oppPres ? (9 + 3 * numTMates) : (9 + 2 * numTMates);
-
-  for(int i = 0; i < state_vec.size()-2; i++) {
-
-    // Ignore first six featues
-    if(i == 5 || i==8) continue;
-    if(i>9 && i<= 9+numTMates) continue; // Ignore Goal Opening angles, as invalid
-    if(i<= 9+3*numTMates && i > 9+2*numTMates) continue; // Ignore Pass Opening angles, as invalid
-    // Ignore Uniform Number of Teammates and opponents
-    int temp =  i-tmpIndex;
-    if(temp > 0 && (temp % 3 == 0) )continue;
-    //if (i > 9+6*numTMates) continue;
-    state[stateIndex] = state_vec[i];
-    stateIndex++;
-  }
-}
-
-// Convert int to hfo::Action
-hfo::action_t toAction(int action, const std::vector<float>& state_vec) {
-hfo::action_t a;
-  switch (action) {
-        case 0: a = hfo::MOVE; break;
-        case 1: a = hfo::REDUCE_ANGLE_TO_GOAL; break;
-        case 2: a = hfo::GO_TO_BALL; break;
-        case 3: a = hfo::NOOP; break;
-        case 4: a = hfo::DEFEND_GOAL; break;
-        default : a = hfo::MARK_PLAYER; break;
-  }
-    return a;
-}
-
 void offenseAgent(int port, int numTMates, int numOpponents, int numEpi, double learnR,
                   int suffix, bool oppPres, double eps, int step, std::string weightid) { 
 
   // Number of features
-  int numF = oppPres ? (8 + 3 * numTMates + 2*numOpponents) : (3 + 3 * numTMates);
+  int numF = numFeatures(numTMates, numOpponents, oppPres);
   // Number of actions
-  int numA = 5 + numOpponents; //DEF_GOAL+MOVE+GTB+NOOP+RATG+MP(unum)
+  int numA = numActions(numOpponents); //DEF_GOAL+MOVE+GTB+NOOP+RATG+MP(unum)
 
   // Other SARSA parameters
   eps = 0.01;
@@ -131,6 +79,7 @@ void offenseAgent(int port, int numTMates, int numOpponents, int numEpi, double
   double reward;
   int no_of_offense = numTMates + 1;
   hfo.connectToServer(hfo::HIGH_LEVEL_FEATURE_SET,"../../bin/teams/base/config/formations-dt",port,"localhost","base_right",false,"");
+  hfo.addReward(hfo::GOAL_REWARD);
 
 
   for (int episode=0; episode < numEpi; episode++) {
@@ -160,7 +109,7 @@ void offenseAgent(int port, int numTMates, int numOpponents, int numEpi, double
       }
       
       if(action != -1) {
-        reward = getReward(status);
+        reward = hfo.getReward();
         sa->update(state, action, reward, discFac);
       }
 
@@ -189,7 +138,7 @@ void offenseAgent(int port, int numTMates, int numOpponents, int numEpi, double
     //std :: cout <<":::::::::::::" << num_steps_per_epi<< " "<<step << " "<<"\n";
     // End of episode
     if(action != -1) {
-      reward = getReward(status);
+      reward = hfo.getReward();
       sa->update(state, action, reward, discFac);
       sa->endEpisode();
     }
@@ -1,10 +1,58 @@
 #include "CMAC.h"
 
 #define TILINGS_PER_GROUP 32
+#define STATES_PER_BATCH 64 // states hashed at once by computeQBatch
 
-CMAC::CMAC(int numF, int numA, double r[], double m[], double res[]):FunctionApproximator(numF,numA){
+CMAC::CMAC(int numF, int numA, double r[], double m[], double res[],
+           int memorySize):FunctionApproximator(numF,numA){
 
-  for(int i = 0; i < numF; i++){
+  this->memorySize = memorySize;
+  weights = new float[memorySize];
+  ownWeights = true;
+  for(int i = 0; i < memorySize; i++){
+    weights[i] = 0;
+  }
+
+  colTab = new collision_table( memorySize, 1 );
+
+  init(r, m, res);
+}
+
+CMAC::CMAC(int numF, int numA, double r[], double m[], double res[],
+           int memorySize, float *weightTable, long *collisionData):FunctionApproximator(numF,numA){
+
+  this->memorySize = memorySize;
+  weights = weightTable;
+  ownWeights = false;
+
+  colTab = new collision_table( memorySize, 1, collisionData );
+
+  init(r, m, res);
+}
+
+CMAC::CMAC(CMAC *shared):FunctionApproximator(shared->getNumFeatures(),
+                                              shared->getNumActions()){
+
+  memorySize = shared->memorySize;
+  weights = shared->weights;
+  ownWeights = false;
+
+  colTab = new collision_table( memorySize, 1, shared->colTab->data );
+
+  init(shared->ranges, shared->minValues, shared->resolutions);
+}
+
+CMAC::~CMAC(){
+
+  if(ownWeights){
+    delete[] weights;
+  }
+  delete colTab;
+}
+
+void CMAC::init(double r[], double m[], double res[]){
+
+  for(int i = 0; i < getNumFeatures(); i++){
     ranges[i] = r[i];
     minValues[i] = m[i];
     resolutions[i] = res[i];
@@ -12,17 +60,19 @@ CMAC::CMAC(int numF, int numA, double r[], double m[], double res[]):FunctionApp
 
   minimumTrace = 0.01;
 
-  numNonzeroTraces = 0;
-  for(int i = 0; i < RL_MEMORY_SIZE; i++){
-    weights[i] = 0;
-    traces[i] = 0;
-  }
+  tilingsPerAction = getNumFeatures() * TILINGS_PER_GROUP;
+  tiles.assign(getNumActions() * tilingsPerAction, 0);
+  prevTiles.assign(tiles.size(), 0);
+  tilesValid = false;
+  prevTilesValid = false;
+  tileSums.resize(getNumActions() * TILINGS_PER_GROUP);
+  tileChecks.resize(getNumActions() * TILINGS_PER_GROUP);
+  numTilings = 0;
 
   srand((unsigned int)0);
   int tmp[2];
   float tmpf[2];
-  colTab = new collision_table( RL_MEMORY_SIZE, 1 );
-    
+
   GetTiles(tmp, 1, 1, tmpf, 0);// A dummy call to set the hashing table    
 }
 
@@ -38,40 +88,64 @@ double CMAC::getResolution(int i){
   return resolutions[i];
 }
 
+bool CMAC::sameState(const double s[], const double t[]){
+
+  for(int i = 0; i < getNumFeatures(); i++){
+    if(s[i] != t[i]){
+      return false;
+    }
+  }
+  return true;
+}
+
+// The tiles of a state never change once hashed, so the tiles of the
+// current and the previous state are reused when one of them is set again.
 void CMAC::setState(double s[]){  
+
+  if(tilesValid && sameState(s, state)){
+    return;
+  }
+
+  if(prevTilesValid && sameState(s, prevState)){
+    tiles.swap(prevTiles);
+    for(int i = 0; i < getNumFeatures(); i++){
+      prevState[i] = state[i];
+    }
+    FunctionApproximator::setState(s);
+    return;
+  }
+
+  tiles.swap(prevTiles);
+  for(int i = 0; i < getNumFeatures(); i++){
+    prevState[i] = state[i];
+  }
+  prevTilesValid = tilesValid;
+
   FunctionApproximator::setState(s);
   loadTiles();
+  tilesValid = true;
 }
 
 void CMAC::updateWeights(double delta, double alpha){
 
   double tmp = delta * alpha / numTilings;
   
-  for(int i = 0; i < numNonzeroTraces; i++){
-
-    int f = nonzeroTraces[i];
-    if(f > RL_MEMORY_SIZE || f < 0){
-      std::cerr << "f is too big or too small!!" << f << "\n";
-    }
-
-    weights[f] += tmp * traces[f];
+  for(int loc = 0; loc < traces.size(); loc++){
+    weights[traces.feature(loc)] += tmp * traces.trace(loc);
   }
 }
 
 // Decays all the (nonzero) traces by decay_rate, removing those below minimum_trace 
 void CMAC::decayTraces(double decayRate){
 
-  int f;
-  for(int loc = numNonzeroTraces - 1; loc >= 0; loc--){
+  for(int loc = traces.size() - 1; loc >= 0; loc--){
     
-    f = nonzeroTraces[loc];
-    if(f > RL_MEMORY_SIZE || f < 0){
-      std::cerr << "DecayTraces: f out of range " << f << "\n";
+    double t = traces.trace(loc) * decayRate;
+    if(t < minimumTrace){
+      traces.removeAt(loc);
     }
-
-    traces[f] *= decayRate;
-    if(traces[f] < minimumTrace){
-      clearExistentTrace(f, loc);
+    else{
+      traces.setTraceAt(loc, t);
     }
 
   }
@@ -80,55 +154,37 @@ void CMAC::decayTraces(double decayRate){
 // Clear any trace for feature f      
 void CMAC::clearTrace(int f){
 
-  if(f > RL_MEMORY_SIZE || f < 0){
-    std::cerr << "ClearTrace: f out of range " << f << "\n";
-  }
-
-  if(traces[f] != 0){
-    clearExistentTrace(f, nonzeroTracesInverse[f]);
+  int loc = traces.find(f);
+  if(loc >= 0){
+    traces.removeAt(loc);
   }
 }
 
-// Clear the trace for feature f at location loc in the list of nonzero traces 
-void CMAC::clearExistentTrace(int f, int loc){
-
-  if(f > RL_MEMORY_SIZE || f < 0){
-    std::cerr << "ClearExistentTrace: f out of range " << f << "\n";
-  }
-
-  traces[f] = 0.0;
-  numNonzeroTraces--;
-  nonzeroTraces[loc] = nonzeroTraces[numNonzeroTraces];
-  nonzeroTracesInverse[nonzeroTraces[loc]] = loc;
-}
-
 // Set the trace for feature f to the given value, which must be positive   
 void CMAC::setTrace(int f, double newTraceValue){
 
-  if(f > RL_MEMORY_SIZE || f < 0){
+  if(f >= memorySize || f < 0){
     std::cerr << "SetTraces: f out of range " << f << "\n";
   }
 
-  if(traces[f] >= minimumTrace){
-    traces[f] = newTraceValue;// trace already exists              
+  int loc = traces.find(f);
+  if(loc >= 0){
+    traces.setTraceAt(loc, newTraceValue);// trace already exists              
   }
   else{
 
-    while(numNonzeroTraces >= RL_MAX_NONZERO_TRACES){
+    while(traces.size() >= RL_MAX_NONZERO_TRACES){
       increaseMinTrace();// ensure room for new trace
     }
 
-    traces[f] = newTraceValue;
-    nonzeroTraces[numNonzeroTraces] = f;
-    nonzeroTracesInverse[f] = numNonzeroTraces;
-    numNonzeroTraces++;
+    traces.set(f, newTraceValue);
   }
 }
 
 // Set the trace for feature f to the given value, which must be positive   
 void CMAC::updateTrace(int f, double deltaTraceValue){
 
-  setTrace(f, traces[f] + deltaTraceValue);
+  setTrace(f, traces.get(f) + deltaTraceValue);
 }
 
 // Try to make room for more traces by incrementing minimum_trace by 10%,
@@ -136,45 +192,60 @@ void CMAC::updateTrace(int f, double deltaTraceValue){
 void CMAC::increaseMinTrace(){
 
   minimumTrace *= 1.1;
-  std::cerr << "Changing minimum_trace to " << minimumTrace << std::endl;
 
-  for (int loc = numNonzeroTraces - 1; loc >= 0; loc--){ // necessary to loop downwards    
-    int f = nonzeroTraces[loc];
-    if(traces[f] < minimumTrace){
-      clearExistentTrace(f, loc);
+  for (int loc = traces.size() - 1; loc >= 0; loc--){ // necessary to loop downwards    
+    if(traces.trace(loc) < minimumTrace){
+      traces.removeAt(loc);
     }
 
   }
 }
 
-void CMAC::read(char *fileName){
+// The image keeps the double weights of the original file format, so files
+// of the same memory size stay interchangeable.
+void CMAC::snapshot(std::string &data){
 
-  std::fstream file;
-  file.open(fileName, std::ios::in | std::ios::binary);
-  file.read((char *) weights, RL_MEMORY_SIZE * sizeof(double));
-  unsigned long pos = file.tellg();
-  file.close();
+  data.reserve(memorySize * (sizeof(double) + sizeof(long))
+               + 4 * sizeof(long) + sizeof(int));
+  data.resize(memorySize * sizeof(double));
+  double *buffer = (double *) &data[0];
+  for(int i = 0; i < memorySize; i++){
+    buffer[i] = weights[i];
+  }
 
-  colTab->restore(fileName, pos);
+  colTab->save(data);
 }
 
-void CMAC::write(char *fileName){
+bool CMAC::restore(const std::string &data){
 
-  std::fstream file;
-  file.open(fileName, std::ios::out | std::ios::binary);
-  file.write((char *) weights, RL_MEMORY_SIZE * sizeof(double));
-  unsigned long pos = file.tellp();
-  file.close();
+  size_t expected = memorySize * (sizeof(double) + sizeof(long))
+    + 4 * sizeof(long) + sizeof(int);
+  if(data.size() != expected){
+    std::cerr << "CMAC: weights do not match memory size " << memorySize << "\n";
+    return false;
+  }
+
+  if(!colTab->restore(data, memorySize * sizeof(double))){
+    return false;
+  }
 
-  colTab->save(fileName, pos);
+  const double *buffer = (const double *) data.data();
+  for(int i = 0; i < memorySize; i++){
+    weights[i] = (float) buffer[i];
+  }
+
+  // The restored collision table maps states to other tiles
+  tilesValid = false;
+  prevTilesValid = false;
+  return true;
 }
 
 void CMAC::reset(){
   
-  for (int i = 0; i < RL_MEMORY_SIZE; i++){
+  for (int i = 0; i < memorySize; i++){
     weights[i] = 0;
-    traces[i] = 0;
   }
+  traces.clear();
 }
 
 void CMAC::loadTiles(){
@@ -186,40 +257,124 @@ void CMAC::loadTiles(){
   /* One tiling for each state variable */
   for(int v = 0; v < getNumFeatures(); v++){
 
+    // same tiles as GetTiles1(..., tilingsPerGroup, colTab, state[v] / getResolution(v), a, v)
+    float f = state[v] / getResolution(v);
+    GetTiles1Hashes(&tileSums[0], &tileChecks[0], tilingsPerGroup, &f, 1, getNumActions(), v);
+
+    int i = 0;
     for(int a = 0; a < getNumActions(); a++){
-      GetTiles1(&(tiles[a][numTilings]), tilingsPerGroup, colTab, state[v] / getResolution(v), a , v);
+      int *t = &tiles[a * tilingsPerAction + numTilings];
+      for(int j = 0; j < tilingsPerGroup; j++, i++){
+        t[j] = ResolveTile(colTab, tileSums[i], tileChecks[i]);
+      }
     }  
 
     numTilings += tilingsPerGroup;
 
   }
-
-  if(numTilings > RL_MAX_NUM_TILINGS){
-    std::cerr << "TOO MANY TILINGS! " << numTilings << "\n";
-  }
 }
 
 double CMAC::computeQ(int action){
 
+  const int *t = &tiles[action * tilingsPerAction];
   double q = 0;
   for(int j = 0; j < numTilings; j++){
-    q += weights[tiles[action][j]];
+    q += weights[t[j]];
   }
 
   return q;
 }
 
+// All actions are summed in one sweep over the tilings, with independent
+// accumulators so that the weight loads of the actions overlap.
+void CMAC::computeAllQ(double q[]){
+
+  const int numA = getNumActions();
+  for(int a = 0; a < numA; a++){
+    q[a] = 0;
+  }
+
+  for(int j = 0; j < numTilings; j++){
+    const int *t = &tiles[j];
+    for(int a = 0; a < numA; a++){
+      q[a] += weights[t[a * tilingsPerAction]];
+    }
+  }
+}
+
+void CMAC::computeQBatch(const double states[], int numStates, double q[]){
+
+  int numF = getNumFeatures();
+  int numA = getNumActions();
+  int groupSize = numA * TILINGS_PER_GROUP; // hashes per state and feature
+
+  for(int first = 0; first < numStates; first += STATES_PER_BATCH){
+
+    int n = numStates - first;
+    if(n > STATES_PER_BATCH){
+      n = STATES_PER_BATCH;
+    }
+
+    // Hash every feature of the chunk, laid out as [v][k][a][j]
+    scaledStates.resize(n);
+    tileSums.resize((size_t) numF * n * groupSize);
+    tileChecks.resize(tileSums.size());
+    for(int v = 0; v < numF; v++){
+      for(int k = 0; k < n; k++){
+        scaledStates[k] = states[(first + k) * numF + v] / getResolution(v);
+      }
+      size_t offset = (size_t) v * n * groupSize;
+      GetTiles1Hashes(&tileSums[offset], &tileChecks[offset], TILINGS_PER_GROUP,
+                      &scaledStates[0], n, numA, v);
+    }
+
+    // Resolve in the order of setState() on each state
+    for(int k = 0; k < n; k++){
+      double *qk = &q[(first + k) * numA];
+      for(int a = 0; a < numA; a++){
+        qk[a] = 0;
+      }
+      for(int v = 0; v < numF; v++){
+        size_t i = ((size_t) v * n + k) * groupSize;
+        for(int a = 0; a < numA; a++){
+          for(int j = 0; j < TILINGS_PER_GROUP; j++, i++){
+            qk[a] += weights[ResolveTile(colTab, tileSums[i], tileChecks[i])];
+          }
+        }
+      }
+    }
+  }
+
+  // loadTiles() only needs the hashes of one feature
+  tileSums.resize(groupSize);
+  tileChecks.resize(groupSize);
+}
+
 void CMAC::clearTraces(int action){
 
+  const int *t = &tiles[action * tilingsPerAction];
   for(int j = 0; j < numTilings; j++){
-    clearTrace(tiles[action][j]);
+    clearTrace(t[j]);
   }
 }
 
 void CMAC::updateTraces(int action){
 
+  const int *t = &tiles[action * tilingsPerAction];
   for(int j = 0; j < numTilings; j++)//replace/set traces F[a]
-    setTrace(tiles[action][j], 1.0);
+    setTrace(t[j], 1.0);
+}
+
+int CMAC::getNumTraces(){
+  return traces.size();
+}
+
+double CMAC::getMinimumTrace(){
+  return minimumTrace;
+}
+
+int CMAC::getTilingsPerAction(){
+  return tilingsPerAction;
 }
 
 //Not implemented by CMAC
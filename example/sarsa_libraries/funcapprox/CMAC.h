@@ -5,34 +5,47 @@
 #include "FuncApprox.h"
 #include "tiles2.h"
 
-#define RL_MEMORY_SIZE 1048576
+#include "TraceMap.h"
+
+#include <vector>
+
+#define RL_MEMORY_SIZE 1048576 // Default number of weights
 #define RL_MAX_NONZERO_TRACES 100000
-#define RL_MAX_NUM_TILINGS 6000
 
 class CMAC: public FunctionApproximator{
 
  protected:
 
-  int tiles[MAX_ACTIONS][RL_MAX_NUM_TILINGS];
+  int memorySize;        // number of weights, a power of 2
+  int tilingsPerAction;  // tile indices stored per action
+  std::vector<int> tiles; // tiles[a * tilingsPerAction + j]
+  bool tilesValid;
+
+  // Tiles of the state before the current one. SARSA revisits the last
+  // state on every step, so setState() swaps them back instead of hashing.
+  std::vector<int> prevTiles;
+  double prevState[MAX_STATE_VARS];
+  bool prevTilesValid;
+
+  bool sameState(const double s[], const double t[]);
+  std::vector<long> tileSums, tileChecks; // work area of the tile hashes
+  std::vector<float> scaledStates;        // work area of computeQBatch
 
   double minimumTrace;
-  int nonzeroTraces[RL_MAX_NONZERO_TRACES];
-  int numNonzeroTraces;
-  int nonzeroTracesInverse[RL_MEMORY_SIZE];
+  TraceMap traces;
 
   double ranges[MAX_STATE_VARS];
   double minValues[MAX_STATE_VARS];
   double resolutions[MAX_STATE_VARS];
 
-  double weights[RL_MEMORY_SIZE];
-  double traces [RL_MEMORY_SIZE];
+  float *weights;  // memorySize entries, owned unless given by a subclass
+  bool ownWeights;
 
   int numTilings;
 
   collision_table *colTab;
 
   void clearTrace(int f);
-  void clearExistentTrace(int f, int loc);
   void setTrace(int f, double newTraceValue);
   void updateTrace(int f, double deltaTraceValue);
   void increaseMinTrace();
@@ -45,9 +58,26 @@ class CMAC: public FunctionApproximator{
   double getMinValue(int i); 
   double getResolution(int i); 
 
+  // Uses the given weight table and collision table storage (memorySize
+  // entries each) instead of allocating them. The storage is not cleared.
+  CMAC(int numF, int numA, double r[], double m[], double res[],
+       int memorySize, float *weightTable, long *collisionData);
+
+ private:
+
+  void init(double r[], double m[], double res[]);
+
  public:
 
-  CMAC(int numF, int numA, double r[], double m[], double res[]);
+  // memorySize is the number of weights and must be a power of 2
+  CMAC(int numF, int numA, double r[], double m[], double res[],
+       int memorySize = RL_MEMORY_SIZE);
+  // Learns into the weight table and collision table of shared, e.g. for
+  // agents on several threads of one process. The state and the traces
+  // are private; weight updates are unsynchronized, as in SharedCMAC.
+  // shared must outlive this CMAC.
+  explicit CMAC(CMAC *shared);
+  virtual ~CMAC();
 
   void setState(double s[]);
 
@@ -55,8 +85,16 @@ class CMAC: public FunctionApproximator{
 
   void decayTraces(double decayRate);
 
-  void read (char *fileName);
-  void write(char *fileName);
+  void snapshot(std::string &data);
+  bool restore(const std::string &data);
+
+  // Number of nonzero traces, and the trace below which traces are dropped
+  // (raised whenever RL_MAX_NONZERO_TRACES are reached)
+  int getNumTraces();
+  double getMinimumTrace();
+
+  // Tiles active per action in a state: the tilings of all features
+  int getTilingsPerAction();
 
   //Not implemented by CMAC
   int getNumWeights();
@@ -64,6 +102,10 @@ class CMAC: public FunctionApproximator{
   void setWeights(double w[]);
 
   double computeQ(int action);
+  void computeAllQ(double q[]);
+
+  // The tiles are the same as with setState() on each state in turn
+  void computeQBatch(const double states[], int numStates, double q[]);
   void clearTraces(int action);
   void updateTraces(int action);
 
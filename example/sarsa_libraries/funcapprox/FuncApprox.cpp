@@ -1,4 +1,7 @@
 #include "FuncApprox.h"
+#include "WeightFile.h"
+
+#include <iostream>
 
 FunctionApproximator::FunctionApproximator(int numF, int numA){
 
@@ -22,17 +25,65 @@ int FunctionApproximator::getNumActions(){
   return numActions;  
 }
 
+void FunctionApproximator::read(char *fileName){
+
+  std::string data;
+  if(!readWeightFile(fileName, data)){
+    return;// nothing saved yet
+  }
+
+  if(!restore(data)){
+    std::cerr << fileName << " does not match the function approximator" << std::endl;
+  }
+}
+
+void FunctionApproximator::write(char *fileName){
+
+  std::string data;
+  snapshot(data);
+  writeWeightFile(fileName, data);
+}
+
+void FunctionApproximator::computeAllQ(double q[]){
+
+  for(int a = 0; a < getNumActions(); a++){
+    q[a] = computeQ(a);
+  }
+}
+
+void FunctionApproximator::computeQBatch(const double states[], int numStates,
+                                         double q[]){
+
+  double current[MAX_STATE_VARS], s[MAX_STATE_VARS];
+  for(int i = 0; i < numFeatures; i++){
+    current[i] = state[i];
+  }
+
+  for(int k = 0; k < numStates; k++){
+    for(int i = 0; i < numFeatures; i++){
+      s[i] = states[k * numFeatures + i];
+    }
+    setState(s);
+    computeAllQ(&q[k * numActions]);
+  }
+
+  setState(current);
+}
+
 int FunctionApproximator::argMaxQ(){
 
+  double Q[MAX_ACTIONS];
+  computeAllQ(Q);
+
   int bestAction = 0;
-  double bestValue = computeQ(bestAction);
+  double bestValue = Q[bestAction];
 
   int numTies = 0;
   double EPS = 1.0e-4;
 
   for(int a = 1; a < getNumActions(); a++){
     
-    double q = computeQ(a);
+    double q = Q[a];
 
     if(fabs(q - bestValue) < EPS){
       numTies++;
@@ -54,15 +105,18 @@ int FunctionApproximator::argMaxQ(){
 
 double FunctionApproximator::bestQ(){
 
+  double Q[MAX_ACTIONS];
+  computeAllQ(Q);
+
   int bestAction = 0;
-  double bestValue = computeQ(bestAction);
+  double bestValue = Q[bestAction];
 
   int numTies = 0;
   double EPS = 1.0e-4;
 
   for(int a = 1; a < getNumActions(); a++){
     
-    double q = computeQ(a);
+    double q = Q[a];
 
     if(fabs(q - bestValue) < EPS){
       numTies++;
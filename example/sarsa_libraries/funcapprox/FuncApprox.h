@@ -3,6 +3,7 @@
 
 #include <stdlib.h>
 #include <math.h>
+#include <string>
 
 #define MAX_STATE_VARS 100
 #define MAX_ACTIONS 10
@@ -26,6 +27,12 @@ class FunctionApproximator{
   virtual void setState(double s[]);
 
   virtual double computeQ(int action) = 0;
+  // Fills q[a] = computeQ(a) for every action
+  virtual void computeAllQ(double q[]);
+  // Computes the Q values of a batch of states, e.g. for offline replay.
+  // states holds numStates rows of getNumFeatures() values, q receives
+  // numStates rows of getNumActions() values. The current state is unchanged.
+  virtual void computeQBatch(const double states[], int numStates, double q[]);
   virtual int argMaxQ();
   virtual double bestQ();
   virtual void updateWeights(double delta, double alpha) = 0;
@@ -34,8 +41,16 @@ class FunctionApproximator{
   virtual void decayTraces(double decayRate) = 0;
   virtual void updateTraces(int action) = 0;
 
-  virtual void read (char *fileName) = 0;
-  virtual void write(char *fileName) = 0;
+  // The weight file is the snapshot() image, written atomically (see
+  // WeightFile.h). read() keeps the weights if the file does not exist.
+  virtual void read (char *fileName);
+  virtual void write(char *fileName);
+
+  // Copies the learned state into data, so that it can be written out
+  // while learning goes on. restore() returns false if data does not
+  // match this approximator.
+  virtual void snapshot(std::string &data) = 0;
+  virtual bool restore(const std::string &data) = 0;
 
   virtual int getNumWeights() = 0;
   virtual void getWeights(double w[]) = 0;
@@ -0,0 +1,344 @@
+#include "MLP.h"
+
+#include <cstring>
+#include <iostream>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#define MLP_ALIGN 8 // floats per row boundary, a multiple of every vector width
+#define MLP_MAGIC 0x4d4c5031 // "MLP1", first int of the weight file
+
+// Vector kernels. Arrays are aligned to MLP_ALIGN floats and n is a
+// multiple of MLP_ALIGN.
+
+#if defined(__AVX__)
+
+#define VWIDTH 8
+typedef __m256 vfloat;
+static inline vfloat vload(const float *p){ return _mm256_load_ps(p); }
+static inline void vstore(float *p, vfloat v){ _mm256_store_ps(p, v); }
+static inline vfloat vset(float x){ return _mm256_set1_ps(x); }
+static inline vfloat vmul(vfloat a, vfloat b){ return _mm256_mul_ps(a, b); }
+#if defined(__FMA__)
+static inline vfloat vfma(vfloat a, vfloat b, vfloat c){ return _mm256_fmadd_ps(a, b, c); }
+#else
+static inline vfloat vfma(vfloat a, vfloat b, vfloat c){ return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+#endif
+static inline float vsum(vfloat v){
+  __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+  s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+  s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+  return _mm_cvtss_f32(s);
+}
+
+#elif defined(__SSE2__)
+
+#define VWIDTH 4
+typedef __m128 vfloat;
+static inline vfloat vload(const float *p){ return _mm_load_ps(p); }
+static inline void vstore(float *p, vfloat v){ _mm_store_ps(p, v); }
+static inline vfloat vset(float x){ return _mm_set1_ps(x); }
+static inline vfloat vmul(vfloat a, vfloat b){ return _mm_mul_ps(a, b); }
+static inline vfloat vfma(vfloat a, vfloat b, vfloat c){ return _mm_add_ps(_mm_mul_ps(a, b), c); }
+static inline float vsum(vfloat v){
+  __m128 s = _mm_add_ps(v, _mm_movehl_ps(v, v));
+  s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+  return _mm_cvtss_f32(s);
+}
+
+#elif defined(__ARM_NEON)
+
+#define VWIDTH 4
+typedef float32x4_t vfloat;
+static inline vfloat vload(const float *p){ return vld1q_f32(p); }
+static inline void vstore(float *p, vfloat v){ vst1q_f32(p, v); }
+static inline vfloat vset(float x){ return vdupq_n_f32(x); }
+static inline vfloat vmul(vfloat a, vfloat b){ return vmulq_f32(a, b); }
+static inline vfloat vfma(vfloat a, vfloat b, vfloat c){ return vmlaq_f32(c, a, b); }
+static inline float vsum(vfloat v){
+  float32x2_t s = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+  return vget_lane_f32(vpadd_f32(s, s), 0);
+}
+
+#else
+
+#define VWIDTH 1
+typedef float vfloat;
+static inline vfloat vload(const float *p){ return *p; }
+static inline void vstore(float *p, vfloat v){ *p = v; }
+static inline vfloat vset(float x){ return x; }
+static inline vfloat vmul(vfloat a, vfloat b){ return a * b; }
+static inline vfloat vfma(vfloat a, vfloat b, vfloat c){ return a * b + c; }
+static inline float vsum(vfloat v){ return v; }
+
+#endif
+
+// Dot products of four rows with x, sharing the loads of x
+static void dot4(const float *r0, const float *r1, const float *r2,
+                 const float *r3, const float *x, int n, float out[4]){
+
+  vfloat s0 = vset(0), s1 = vset(0), s2 = vset(0), s3 = vset(0);
+  for(int i = 0; i < n; i += VWIDTH){
+    vfloat xi = vload(x + i);
+    s0 = vfma(vload(r0 + i), xi, s0);
+    s1 = vfma(vload(r1 + i), xi, s1);
+    s2 = vfma(vload(r2 + i), xi, s2);
+    s3 = vfma(vload(r3 + i), xi, s3);
+  }
+  out[0] = vsum(s0);
+  out[1] = vsum(s1);
+  out[2] = vsum(s2);
+  out[3] = vsum(s3);
+}
+
+static float dot(const float *r, const float *x, int n){
+
+  vfloat s = vset(0);
+  for(int i = 0; i < n; i += VWIDTH){
+    s = vfma(vload(r + i), vload(x + i), s);
+  }
+  return vsum(s);
+}
+
+// y += a * x
+static void axpy(float *y, float a, const float *x, int n){
+
+  vfloat va = vset(a);
+  for(int i = 0; i < n; i += VWIDTH){
+    vstore(y + i, vfma(va, vload(x + i), vload(y + i)));
+  }
+}
+
+// x *= a
+static void scale(float *x, float a, int n){
+
+  vfloat va = vset(a);
+  for(int i = 0; i < n; i += VWIDTH){
+    vstore(x + i, vmul(va, vload(x + i)));
+  }
+}
+
+static int roundUp(int n){
+  return (n + MLP_ALIGN - 1) / MLP_ALIGN * MLP_ALIGN;
+}
+
+static float *alignedFloats(int n){
+
+  void *p;
+  if(posix_memalign(&p, MLP_ALIGN * sizeof(float), n * sizeof(float)) != 0){
+    std::cerr << "MLP: Out of Memory" << std::endl;
+    exit(1);
+  }
+  memset(p, 0, n * sizeof(float));
+  return (float *) p;
+}
+
+MLP::MLP(int numF, int numA, double r[], double m[],
+         int numHidden):FunctionApproximator(numF,numA){
+
+  this->numHidden = numHidden;
+  inputStride = roundUp(numF);
+  hiddenStride = roundUp(numHidden);
+  outputStride = roundUp(numA);
+  numParams = numHidden * inputStride + hiddenStride
+    + numA * hiddenStride + outputStride;
+
+  for(int i = 0; i < numF; i++){
+    ranges[i] = r[i];
+    minValues[i] = m[i];
+  }
+
+  params = alignedFloats(numParams);
+  traces = alignedFloats(numParams);
+  input = alignedFloats(inputStride);
+  hidden = alignedFloats(hiddenStride);
+
+  seed = 1;
+  reset();
+}
+
+MLP::~MLP(){
+
+  free(params);
+  free(traces);
+  free(input);
+  free(hidden);
+}
+
+// Glorot-uniform hidden weights. The output weights start at zero, so that
+// every Q value starts at 0 as with CMAC. A private generator keeps the
+// drand48() sequence of the agents unchanged.
+void MLP::initWeights(){
+
+  memset(params, 0, numParams * sizeof(float));
+
+  double limit = sqrt(6.0 / (getNumFeatures() + numHidden));
+  for(int h = 0; h < numHidden; h++){
+    float *row = w1() + h * inputStride;
+    for(int i = 0; i < getNumFeatures(); i++){
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      double u = (seed >> 11) * (1.0 / 9007199254740992.0); // [0, 1)
+      row[i] = (float) ((2 * u - 1) * limit);
+    }
+  }
+  forwardValid = false;
+}
+
+void MLP::setState(double s[]){
+
+  FunctionApproximator::setState(s);
+
+  for(int i = 0; i < getNumFeatures(); i++){
+    input[i] = (float) (2 * (s[i] - minValues[i]) / ranges[i] - 1);
+  }
+  forwardValid = false;
+}
+
+void MLP::forward(){
+
+  const float *w = w1();
+  const float *b = b1();
+  int h = 0;
+  for(; h + 4 <= numHidden; h += 4){
+    float a[4];
+    dot4(w + h * inputStride, w + (h + 1) * inputStride,
+         w + (h + 2) * inputStride, w + (h + 3) * inputStride,
+         input, inputStride, a);
+    for(int k = 0; k < 4; k++){
+      hidden[h + k] = tanhf(a[k] + b[h + k]);
+    }
+  }
+  for(; h < numHidden; h++){
+    hidden[h] = tanhf(dot(w + h * inputStride, input, inputStride) + b[h]);
+  }
+
+  for(int a = 0; a < getNumActions(); a++){
+    outputs[a] = dot(w2() + a * hiddenStride, hidden, hiddenStride) + b2()[a];
+  }
+  forwardValid = true;
+}
+
+double MLP::computeQ(int action){
+
+  if(!forwardValid){
+    forward();
+  }
+  return outputs[action];
+}
+
+void MLP::computeAllQ(double q[]){
+
+  if(!forwardValid){
+    forward();
+  }
+  for(int a = 0; a < getNumActions(); a++){
+    q[a] = outputs[a];
+  }
+}
+
+void MLP::updateWeights(double delta, double alpha){
+
+  if(tracesZero){
+    return;
+  }
+  axpy(params, (float) (delta * alpha), traces, numParams);
+  forwardValid = false;
+}
+
+void MLP::clearTraces(int action){
+
+  memset(traces + (w2() - params) + action * hiddenStride, 0,
+         hiddenStride * sizeof(float));
+  traces[(b2() - params) + action] = 0;
+}
+
+void MLP::decayTraces(double decayRate){
+
+  if(tracesZero){
+    return;
+  }
+  if(decayRate == 0){
+    memset(traces, 0, numParams * sizeof(float));
+    tracesZero = true;
+  }
+  else{
+    scale(traces, (float) decayRate, numParams);
+  }
+}
+
+void MLP::updateTraces(int action){
+
+  if(!forwardValid){
+    forward();
+  }
+
+  // Output layer: dQ/dW2[action] = hidden, dQ/db2[action] = 1
+  const float *w2a = w2() + action * hiddenStride;
+  axpy(traces + (w2() - params) + action * hiddenStride, 1, hidden, hiddenStride);
+  traces[(b2() - params) + action] += 1;
+
+  // Hidden layer: dQ/da[h] = W2[action][h] * (1 - hidden[h]^2)
+  float *tb1 = traces + (b1() - params);
+  float *tw1 = traces;
+  for(int h = 0; h < numHidden; h++){
+    float g = w2a[h] * (1 - hidden[h] * hidden[h]);
+    if(g != 0){
+      tb1[h] += g;
+      axpy(tw1 + h * inputStride, g, input, inputStride);
+    }
+  }
+  tracesZero = false;
+}
+
+void MLP::snapshot(std::string &data){
+
+  int header[4] = { MLP_MAGIC, getNumFeatures(), getNumActions(), numHidden };
+  data.assign((const char *) header, sizeof(header));
+  data.append((const char *) params, numParams * sizeof(float));
+}
+
+bool MLP::restore(const std::string &data){
+
+  int header[4] = { MLP_MAGIC, getNumFeatures(), getNumActions(), numHidden };
+  if(data.size() != sizeof(header) + numParams * sizeof(float) ||
+     memcmp(data.data(), header, sizeof(header)) != 0){
+    std::cerr << "MLP: weights do not match " << getNumFeatures() << " features, "
+              << getNumActions() << " actions and " << numHidden << " hidden units\n";
+    return false;
+  }
+  memcpy(params, data.data() + sizeof(header), numParams * sizeof(float));
+  forwardValid = false;
+  return true;
+}
+
+int MLP::getNumWeights(){
+  return numParams;
+}
+
+void MLP::getWeights(double w[]){
+
+  for(int i = 0; i < numParams; i++){
+    w[i] = params[i];
+  }
+}
+
+void MLP::setWeights(double w[]){
+
+  for(int i = 0; i < numParams; i++){
+    params[i] = (float) w[i];
+  }
+  forwardValid = false;
+}
+
+void MLP::reset(){
+
+  initWeights();
+  memset(traces, 0, numParams * sizeof(float));
+  tracesZero = true;
+}
@@ -0,0 +1,87 @@
+#ifndef MLP_H
+#define MLP_H
+
+#include "FuncApprox.h"
+
+#define MLP_DEFAULT_HIDDEN 64
+
+// A function approximator for many continuous features, where tile coding
+// needs too much memory: a multilayer perceptron with one tanh hidden
+// layer and one linear output per action.
+//
+// The weights are floats in one block, laid out for the vector kernels of
+// MLP.cpp (AVX, SSE or NEON, with a scalar fallback):
+//
+//   W1[numHidden][inputStride]    hidden weights, one row per hidden unit
+//   b1[hiddenStride]
+//   W2[numActions][hiddenStride]  output weights, one row per action
+//   b2[outputStride]
+//
+// Each row is padded to a multiple of the vector width with zeros, so that
+// every row starts on an aligned boundary. The eligibility traces use the
+// same layout, so that updateWeights() and decayTraces() are one pass over
+// a contiguous array.
+class MLP: public FunctionApproximator{
+
+ private:
+
+  int numHidden;
+  int inputStride, hiddenStride, outputStride;
+  int numParams;
+
+  double ranges[MAX_STATE_VARS];
+  double minValues[MAX_STATE_VARS];
+
+  float *params;  // weights and biases, laid out as above
+  float *traces;  // eligibility traces of params
+  bool tracesZero;
+
+  // Forward pass of the current state, recomputed after weight changes
+  float *input;   // scaled to [-1, 1], inputStride entries
+  float *hidden;  // hiddenStride entries
+  double outputs[MAX_ACTIONS];
+  bool forwardValid;
+
+  unsigned long seed; // of the weight initialization
+
+  float *w1(){ return params; }
+  float *b1(){ return params + numHidden * inputStride; }
+  float *w2(){ return b1() + hiddenStride; }
+  float *b2(){ return w2() + getNumActions() * hiddenStride; }
+
+  void forward();
+  void initWeights();
+
+ public:
+
+  // r and m are the range and minimum of each feature, as for CMAC
+  MLP(int numF, int numA, double r[], double m[],
+      int numHidden = MLP_DEFAULT_HIDDEN);
+  ~MLP();
+
+  void setState(double s[]);
+
+  double computeQ(int action);
+  void computeAllQ(double q[]);
+
+  void updateWeights(double delta, double alpha);
+
+  // Clears the traces of the output weights of action
+  void clearTraces(int action);
+  void decayTraces(double decayRate);
+  // Adds the gradient of computeQ(action) at the current state
+  void updateTraces(int action);
+
+  void snapshot(std::string &data);
+  bool restore(const std::string &data);
+
+  int getNumWeights();
+  void getWeights(double w[]);
+  void setWeights(double w[]);
+
+  // Reinitializes the weights and clears the traces
+  void reset();
+
+};
+
+#endif
@@ -0,0 +1,141 @@
+#include "SharedCMAC.h"
+
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#define SHARED_CMAC_MAGIC 0x434d4143UL // "CMAC"
+#define SHARED_CMAC_VERSION 2
+
+// States of the region, in Header::state
+#define REGION_EMPTY 0        // zero-filled by ftruncate
+#define REGION_INITIALIZING 1
+#define REGION_READY 2
+
+struct SharedWeightRegion::Header{
+  unsigned long magic;
+  unsigned long version;
+  long memorySize;
+  int state;
+  // followed by float weights[memorySize], long collision[memorySize]
+};
+
+// The tables start on a cache line boundary after the header
+#define HEADER_SIZE ((sizeof(SharedWeightRegion::Header) + 63) / 64 * 64)
+
+SharedWeightRegion::SharedWeightRegion(const char *name, int memorySize){
+
+  this->memorySize = memorySize;
+  // the collision table follows the weights; keep it 8-byte aligned
+  regionSize = HEADER_SIZE + (memorySize * sizeof(float) + 7) / 8 * 8
+    + memorySize * sizeof(long);
+
+  int fd = shm_open(name, O_CREAT | O_RDWR, 0600);
+  if(fd < 0){
+    std::cerr << "SharedCMAC: shm_open " << name << " failed" << std::endl;
+    exit(1);
+  }
+
+  // Every agent resizes to the same size, so the race is harmless
+  struct stat st;
+  if(fstat(fd, &st) != 0 || (st.st_size != 0 && (size_t)st.st_size != regionSize) ||
+     (st.st_size == 0 && ftruncate(fd, regionSize) != 0)){
+    std::cerr << "SharedCMAC: " << name << " has an unexpected size" << std::endl;
+    close(fd);
+    exit(1);
+  }
+
+  void *region = mmap(NULL, regionSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if(region == MAP_FAILED){
+    std::cerr << "SharedCMAC: mmap " << name << " failed" << std::endl;
+    exit(1);
+  }
+
+  header = static_cast<Header *>(region);
+  Header *h = header;
+
+  // The first agent clears the collision table; the others wait for it
+  if(__sync_bool_compare_and_swap(&h->state, REGION_EMPTY, REGION_INITIALIZING)){
+    h->magic = SHARED_CMAC_MAGIC;
+    h->version = SHARED_CMAC_VERSION;
+    h->memorySize = memorySize;
+    long *col = collisionData();
+    for(int i = 0; i < memorySize; i++){
+      col[i] = -1;
+    }
+    __sync_synchronize();
+    h->state = REGION_READY;
+  }
+  else{
+    while(*(volatile int *)&h->state != REGION_READY){
+      usleep(1000);
+    }
+    __sync_synchronize();
+  }
+
+  if(h->magic != SHARED_CMAC_MAGIC || h->version != SHARED_CMAC_VERSION ||
+     h->memorySize != memorySize){
+    std::cerr << "SharedCMAC: " << name << " has an incompatible layout" << std::endl;
+    exit(1);
+  }
+}
+
+SharedWeightRegion::~SharedWeightRegion(){
+
+  munmap(header, regionSize);
+}
+
+float* SharedWeightRegion::weightTable(){
+  return reinterpret_cast<float *>(reinterpret_cast<char *>(header) + HEADER_SIZE);
+}
+
+long* SharedWeightRegion::collisionData(){
+  return reinterpret_cast<long *>(reinterpret_cast<char *>(header) + HEADER_SIZE
+                                  + (memorySize * sizeof(float) + 7) / 8 * 8);
+}
+
+// SharedWeightRegion is the first base, so the region is mapped before the
+// CMAC base is given its tables.
+SharedCMAC::SharedCMAC(int numF, int numA, double r[], double m[], double res[],
+                       const char *name, bool atomicUpdates, int memorySize):
+  SharedWeightRegion(name, memorySize),
+  CMAC(numF, numA, r, m, res, memorySize, weightTable(), collisionData()){
+
+  this->atomicUpdates = atomicUpdates;
+}
+
+void SharedCMAC::unlink(const char *name){
+  shm_unlink(name);
+}
+
+// Atomic add on a float, through compare-and-swap of its bit pattern
+static void atomicAdd(float *target, float value){
+
+  unsigned int *bits = reinterpret_cast<unsigned int *>(target);
+  unsigned int oldBits = __atomic_load_n(bits, __ATOMIC_RELAXED);
+  unsigned int newBits;
+  float oldValue, newValue;
+  do{
+    memcpy(&oldValue, &oldBits, sizeof(float));
+    newValue = oldValue + value;
+    memcpy(&newBits, &newValue, sizeof(float));
+  }while(!__atomic_compare_exchange_n(bits, &oldBits, newBits, true,
+                                      __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+void SharedCMAC::updateWeights(double delta, double alpha){
+
+  if(!atomicUpdates){
+    CMAC::updateWeights(delta, alpha);
+    return;
+  }
+
+  double tmp = delta * alpha / numTilings;
+
+  for(int loc = 0; loc < traces.size(); loc++){
+    atomicAdd(&weights[traces.feature(loc)], (float)(tmp * traces.trace(loc)));
+  }
+}
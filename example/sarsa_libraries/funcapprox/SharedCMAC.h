@@ -0,0 +1,66 @@
+#ifndef SHARED_CMAC_H
+#define SHARED_CMAC_H
+
+#include "CMAC.h"
+
+// A POSIX shared-memory object holding a CMAC weight table and tile
+// collision table. The first process to attach clears it; the others wait
+// until it is ready.
+class SharedWeightRegion{
+
+ public:
+
+  struct Header;
+
+ protected:
+
+  Header *header;
+  size_t regionSize;
+  int memorySize;
+
+ public:
+
+  SharedWeightRegion(const char *name, int memorySize);
+  ~SharedWeightRegion();
+
+  float *weightTable();
+  long *collisionData();
+
+};
+
+// A CMAC whose weight table and tile collision table live in a POSIX
+// shared-memory object, so that agents in different processes (or threads)
+// on one host learn into a single table without going through weight files.
+//
+// Traces stay private to each agent. Weight updates are lock-free: by
+// default they are plain Hogwild-style read-modify-writes, which may lose
+// an update when two agents touch the same tile at the same time. With
+// atomicUpdates every update is an atomic compare-and-swap add instead.
+//
+// Every agent must use the same numbers of features and actions and the
+// same tile coding, otherwise the shared tiles have different meanings.
+// Pointers to a SharedCMAC must be converted to CMAC* before being passed
+// through void*.
+class SharedCMAC: private SharedWeightRegion, public CMAC{
+
+ private:
+
+  bool atomicUpdates;
+
+ public:
+
+  // Attaches to the shared-memory object with the given name (e.g.
+  // "/hfo_sarsa"), creating and initializing it if it does not exist.
+  // All agents must pass the same memorySize.
+  SharedCMAC(int numF, int numA, double r[], double m[], double res[],
+             const char *name, bool atomicUpdates = false,
+             int memorySize = RL_MEMORY_SIZE);
+
+  void updateWeights(double delta, double alpha);
+
+  // Removes the shared-memory object. Attached agents keep their mapping.
+  static void unlink(const char *name);
+
+};
+
+#endif
@@ -0,0 +1,106 @@
+#include "TraceMap.h"
+
+TraceMap::TraceMap(int initialCapacity){
+
+  int numSlots = 16;
+  while(numSlots < 2 * initialCapacity){
+    numSlots *= 2;
+  }
+
+  slots.assign(numSlots, -1);
+  mask = numSlots - 1;
+  entries.reserve(initialCapacity);
+}
+
+// Fibonacci hashing spreads the (clustered) tile indices over the table
+static inline int hashFeature(int feature, int mask){
+  return (int)(((unsigned int) feature * 2654435761u) >> 7) & mask;
+}
+
+// Returns the slot holding the feature, or the empty slot ending its probe
+int TraceMap::slotOf(int feature) const{
+
+  int s = hashFeature(feature, mask);
+  while(slots[s] != -1 && entries[slots[s]].feature != feature){
+    s = (s + 1) & mask;
+  }
+  return s;
+}
+
+int TraceMap::find(int feature) const{
+  return slots[slotOf(feature)];
+}
+
+double TraceMap::get(int feature) const{
+
+  int loc = find(feature);
+  return (loc < 0) ? 0.0 : entries[loc].trace;
+}
+
+void TraceMap::set(int feature, double value){
+
+  int s = slotOf(feature);
+  if(slots[s] != -1){
+    entries[slots[s]].trace = value;
+    return;
+  }
+
+  Entry e;
+  e.feature = feature;
+  e.trace = value;
+  slots[s] = (int) entries.size();
+  entries.push_back(e);
+
+  // Keep the load factor at most 1/2
+  if(2 * (int) entries.size() > (int) slots.size()){
+    grow();
+  }
+}
+
+void TraceMap::removeAt(int loc){
+
+  // Backward-shift deletion keeps the probe sequences intact
+  int hole = slotOf(entries[loc].feature);
+  int s = (hole + 1) & mask;
+  while(slots[s] != -1){
+    int home = hashFeature(entries[slots[s]].feature, mask);
+    // move the entry into the hole unless its home lies cyclically in (hole, s]
+    if(((s - home) & mask) >= ((s - hole) & mask)){
+      slots[hole] = slots[s];
+      hole = s;
+    }
+    s = (s + 1) & mask;
+  }
+  slots[hole] = -1;
+
+  int last = (int) entries.size() - 1;
+  if(loc != last){
+    entries[loc] = entries[last];
+    slots[slotOf(entries[loc].feature)] = loc;
+  }
+  entries.pop_back();
+}
+
+void TraceMap::grow(){
+
+  slots.assign(2 * slots.size(), -1);
+  mask = (int) slots.size() - 1;
+
+  for(int loc = 0; loc < (int) entries.size(); loc++){
+    slots[slotOf(entries[loc].feature)] = loc;
+  }
+}
+
+void TraceMap::clear(){
+
+  // Every occupied slot belongs to some entry, so each probe run can be
+  // emptied as a whole
+  for(int loc = 0; loc < (int) entries.size(); loc++){
+    int s = hashFeature(entries[loc].feature, mask);
+    while(slots[s] != -1){
+      slots[s] = -1;
+      s = (s + 1) & mask;
+    }
+  }
+  entries.clear();
+}
@@ -0,0 +1,55 @@
+#ifndef TRACE_MAP_H
+#define TRACE_MAP_H
+
+#include <vector>
+
+// Sparse storage of the nonzero eligibility traces of a function
+// approximator. Traces are kept in a dense list, so that they can be
+// visited in order, and found by feature through an open-addressing
+// (linear probing) hash table. Memory grows with the number of nonzero
+// traces, not with the number of features.
+class TraceMap{
+
+ private:
+
+  struct Entry{
+    int feature;
+    double trace;
+  };
+
+  std::vector<Entry> entries; // nonzero traces, in insertion order
+  std::vector<int> slots;     // hash table of indices into entries, -1 if empty
+  int mask;
+
+  int slotOf(int feature) const;
+  void grow();
+
+ public:
+
+  TraceMap(int initialCapacity = 64);
+
+  int size() const { return (int) entries.size(); }
+
+  // Access by location in the list, 0 <= loc < size()
+  int feature(int loc) const { return entries[loc].feature; }
+  double trace(int loc) const { return entries[loc].trace; }
+  void setTraceAt(int loc, double value) { entries[loc].trace = value; }
+
+  // Returns the location of the feature, or -1 if it has no trace
+  int find(int feature) const;
+
+  // Returns the trace of the feature, or 0 if it has none
+  double get(int feature) const;
+
+  // Sets the trace of the feature, adding it if it has none
+  void set(int feature, double value);
+
+  // Removes the trace at loc. The last trace is moved to loc, so traces
+  // can be removed while looping downwards over the locations.
+  void removeAt(int loc);
+
+  void clear();
+
+};
+
+#endif
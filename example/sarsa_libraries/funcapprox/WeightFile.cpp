@@ -0,0 +1,86 @@
+#include "WeightFile.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#define CHUNK_SIZE (1 << 20)
+
+bool readWeightFile(const char *fileName, std::string &data){
+
+  data.clear();
+
+  // gzread() passes uncompressed files through unchanged
+  gzFile file = gzopen(fileName, "rb");
+  if(file == NULL){
+    return false;
+  }
+
+  int n;
+  do{
+    size_t size = data.size();
+    data.resize(size + CHUNK_SIZE);
+    n = gzread(file, &data[size], CHUNK_SIZE);
+    data.resize(size + (n > 0 ? n : 0));
+  }while(n > 0);
+
+  gzclose(file);
+  return n == 0;
+}
+
+static bool writeAll(int fd, const char *p, size_t size){
+
+  while(size > 0){
+    ssize_t n = write(fd, p, size);
+    if(n < 0){
+      return false;
+    }
+    p += n;
+    size -= n;
+  }
+  return true;
+}
+
+static bool writeCompressed(int fd, const std::string &data){
+
+  // gzclose() closes the descriptor, so hand over a duplicate
+  gzFile file = gzdopen(dup(fd), "wb1");
+  if(file == NULL){
+    return false;
+  }
+
+  bool ok = true;
+  for(size_t pos = 0; ok && pos < data.size(); pos += CHUNK_SIZE){
+    unsigned len = data.size() - pos < CHUNK_SIZE ? data.size() - pos : CHUNK_SIZE;
+    ok = gzwrite(file, data.data() + pos, len) == (int) len;
+  }
+  return gzclose(file) == Z_OK && ok;
+}
+
+bool writeWeightFile(const char *fileName, const std::string &data,
+                     bool compress){
+
+  std::string tmpName = std::string(fileName) + ".XXXXXX";
+  int fd = mkstemp(&tmpName[0]);
+  if(fd < 0){
+    std::cerr << "Cannot create " << tmpName << std::endl;
+    return false;
+  }
+  fchmod(fd, 0644);
+
+  bool ok = compress ? writeCompressed(fd, data)
+    : writeAll(fd, data.data(), data.size());
+  ok = fsync(fd) == 0 && ok;
+  ok = close(fd) == 0 && ok;
+
+  if(!ok || rename(tmpName.c_str(), fileName) != 0){
+    std::cerr << "Cannot write weights to " << fileName << std::endl;
+    unlink(tmpName.c_str());
+    return false;
+  }
+  return true;
+}
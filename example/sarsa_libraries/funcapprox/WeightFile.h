@@ -0,0 +1,17 @@
+#ifndef WEIGHT_FILE_H
+#define WEIGHT_FILE_H
+
+#include <string>
+
+// Reads a whole weight file into data. Files written with compression are
+// recognized and decompressed. Returns false if the file cannot be read.
+bool readWeightFile(const char *fileName, std::string &data);
+
+// Writes data to a temporary file next to fileName and renames it over
+// fileName once it is complete, so that readers (and other agents saving
+// to the same name) never see a partially written file. With compress the
+// file is gzip-compressed. Returns false if the file could not be written.
+bool writeWeightFile(const char *fileName, const std::string &data,
+                     bool compress = false);
+
+#endif
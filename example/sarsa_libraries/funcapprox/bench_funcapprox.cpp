@@ -0,0 +1,315 @@
+// Throughput benchmark of the function approximators.
+//
+// Drives a synthetic stream of HFO-shaped states (high-level features in
+// [-1, 1] that drift a little every step, with a new episode every
+// EPISODE_LENGTH steps) through each approximator, with the calls a
+// SarsaAgent makes per step. Reports SARSA updates per second, the time
+// spent in each call, hardware cache misses (where perf events are
+// available) and the number of nonzero traces.
+//
+// Usage: ./bench_funcapprox [--steps <int>] [--memorySize <int>]
+
+#include "CMAC.h"
+#include "MLP.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#define EPISODE_LENGTH 100
+#define NUM_ACTIONS 5
+
+// Phases of a step, timed separately
+enum { SET_STATE, COMPUTE_Q, UPDATE_TRACES, UPDATE_WEIGHTS, DECAY_TRACES, NUM_PHASES };
+
+static const char *phaseNames[NUM_PHASES] = {
+  "setState", "computeQ", "updTraces", "updWeights", "decay"
+};
+
+static double now(){
+
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// Hardware cache references and misses of this thread, if perf events
+// are permitted
+class CacheCounters{
+
+ private:
+
+  int references, misses;
+
+  static int open(unsigned long config, int group){
+
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = group < 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return syscall(__NR_perf_event_open, &attr, 0, -1, group, 0);
+  }
+
+  static long long value(int fd){
+
+    long long v = 0;
+    if(fd < 0 || read(fd, &v, sizeof(v)) != sizeof(v)){
+      return -1;
+    }
+    return v;
+  }
+
+ public:
+
+  CacheCounters(){
+    references = open(PERF_COUNT_HW_CACHE_REFERENCES, -1);
+    misses = references < 0 ? -1 : open(PERF_COUNT_HW_CACHE_MISSES, references);
+  }
+
+  ~CacheCounters(){
+    if(references >= 0) close(references);
+    if(misses >= 0) close(misses);
+  }
+
+  bool available(){
+    return misses >= 0;
+  }
+
+  void start(){
+    if(available()){
+      ioctl(references, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+      ioctl(references, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+  }
+
+  // Miss rate since start(), or -1
+  double stop(){
+    if(!available()){
+      return -1;
+    }
+    ioctl(references, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    long long r = value(references), m = value(misses);
+    return r > 0 && m >= 0 ? (double) m / r : -1;
+  }
+
+};
+
+// Synthetic state stream
+class StateStream{
+
+ private:
+
+  int numF;
+  int step;
+  std::vector<double> state;
+
+ public:
+
+  StateStream(int numF):numF(numF), step(0), state(numF){
+    srand48(12345);
+  }
+
+  double *next(){
+    for(int i = 0; i < numF; i++){
+      if(step % EPISODE_LENGTH == 0){
+        state[i] = drand48() * 2 - 1;
+      }
+      else{
+        double v = state[i] + (drand48() - 0.5) * 0.1;
+        state[i] = v < -1 ? -1 : (v > 1 ? 1 : v);
+      }
+    }
+    step++;
+    return &state[0];
+  }
+
+  bool episodeEnd(){
+    return step % EPISODE_LENGTH == 0;
+  }
+
+};
+
+struct Result{
+  double updatesPerSec;
+  double phaseNs[NUM_PHASES];
+  double missRate;
+  double meanTraces;
+};
+
+// The calls of SarsaAgent::selectAction() and SarsaAgent::update() per step
+static Result run(FunctionApproximator *fa, int numF, int steps, double lambda,
+                  CacheCounters &counters){
+
+  StateStream stream(numF);
+  double phase[NUM_PHASES] = { 0 };
+  double lastState[MAX_STATE_VARS], q[MAX_ACTIONS];
+  int lastAction = -1;
+  double traceSum = 0;
+  CMAC *cmac = dynamic_cast<CMAC *>(fa);
+
+  double start = now();
+  counters.start();
+
+  for(int k = 0; k < steps; k++){
+
+    double *s = stream.next();
+
+    double t0 = now();
+    fa->setState(s);
+    double t1 = now();
+    fa->computeAllQ(q);
+    double t2 = now();
+    phase[SET_STATE] += t1 - t0;
+    phase[COMPUTE_Q] += t2 - t1;
+
+    int action = 0;
+    for(int a = 1; a < NUM_ACTIONS; a++){
+      if(q[a] > q[action]){
+        action = a;
+      }
+    }
+    if(drand48() < 0.1){
+      action = (int) (drand48() * NUM_ACTIONS);
+    }
+
+    if(lastAction >= 0){
+      t0 = now();
+      fa->setState(lastState);
+      t1 = now();
+      double oldQ = fa->computeQ(lastAction);
+      t2 = now();
+      fa->updateTraces(lastAction);
+      double t3 = now();
+      fa->setState(s);
+      double t4 = now();
+      double newQ = fa->computeQ(action);
+      double t5 = now();
+      fa->updateWeights(drand48() - 0.5 + newQ - oldQ, 0.1);
+      double t6 = now();
+      fa->decayTraces(stream.episodeEnd() ? 0 : lambda);
+      double t7 = now();
+      phase[SET_STATE] += (t1 - t0) + (t4 - t3);
+      phase[COMPUTE_Q] += (t2 - t1) + (t5 - t4);
+      phase[UPDATE_TRACES] += t3 - t2;
+      phase[UPDATE_WEIGHTS] += t6 - t5;
+      phase[DECAY_TRACES] += t7 - t6;
+    }
+
+    if(cmac != NULL){
+      traceSum += cmac->getNumTraces();
+    }
+
+    memcpy(lastState, s, numF * sizeof(double));
+    lastAction = stream.episodeEnd() ? -1 : action;
+  }
+
+  Result r;
+  r.missRate = counters.stop();
+  r.updatesPerSec = steps / (now() - start);
+  for(int p = 0; p < NUM_PHASES; p++){
+    r.phaseNs[p] = phase[p] / steps * 1e9;
+  }
+  r.meanTraces = cmac != NULL ? traceSum / steps : -1;
+  return r;
+}
+
+static void print(const char *name, int numF, int size, double lambda,
+                  const Result &r){
+
+  printf("%-5s %4d %7d %6.4f %10.0f", name, numF, size, lambda, r.updatesPerSec);
+  for(int p = 0; p < NUM_PHASES; p++){
+    printf(" %10.0f", r.phaseNs[p]);
+  }
+  if(r.missRate >= 0){
+    printf(" %7.1f%%", r.missRate * 100);
+  }
+  else{
+    printf(" %8s", "n/a");
+  }
+  if(r.meanTraces >= 0){
+    printf(" %8.0f", r.meanTraces);
+  }
+  else{
+    printf(" %8s", "-");
+  }
+  printf("\n");
+}
+
+int main(int argc, char **argv){
+
+  int steps = 20000;
+  int memorySize = RL_MEMORY_SIZE;
+  for(int i = 1; i < argc; i++){
+    std::string param = argv[i];
+    if(param == "--steps" && i + 1 < argc){
+      steps = atoi(argv[++i]);
+    }
+    else if(param == "--memorySize" && i + 1 < argc){
+      memorySize = atoi(argv[++i]);
+    }
+    else{
+      printf("Usage: %s [--steps <int>] [--memorySize <int>]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  CacheCounters counters;
+  if(!counters.available()){
+    printf("Cache counters not available (perf_event_paranoid?)\n");
+  }
+
+  // size: tilings per action for CMAC, hidden units for MLP
+  printf("%-5s %4s %7s %6s %10s", "FA", "feat", "size", "lambda", "updates/s");
+  for(int p = 0; p < NUM_PHASES; p++){
+    printf(" %8s ns", phaseNames[p]);
+  }
+  printf(" %8s %8s\n", "miss", "traces");
+
+  double ranges[MAX_STATE_VARS], mins[MAX_STATE_VARS], res[MAX_STATE_VARS];
+  for(int i = 0; i < MAX_STATE_VARS; i++){
+    ranges[i] = 2;
+    mins[i] = -1;
+    res[i] = 0.1;
+  }
+
+  // Feature counts of the high-level feature set from 1v0 to 4v4
+  const int cmacFeatures[] = { 4, 8, 12, 20 };
+  const double lambdas[] = { 0, 0.9375 };
+  for(int l = 0; l < 2; l++){
+    for(int f = 0; f < 4; f++){
+      int numF = cmacFeatures[f];
+      CMAC *fa = new CMAC(numF, NUM_ACTIONS, ranges, mins, res, memorySize);
+      Result r = run(fa, numF, steps, lambdas[l], counters);
+      print("CMAC", numF, fa->getTilingsPerAction(), lambdas[l], r);
+      delete fa;
+    }
+  }
+
+  // Low-level feature set sizes
+  const int mlpFeatures[] = { 12, 58, 98 };
+  const int hiddenUnits[] = { 32, 64, 128 };
+  for(int l = 0; l < 2; l++){
+    for(int f = 0; f < 3; f++){
+      for(int h = 0; h < 3; h++){
+        int numF = mlpFeatures[f];
+        MLP *fa = new MLP(numF, NUM_ACTIONS, ranges, mins, hiddenUnits[h]);
+        Result r = run(fa, numF, steps, lambdas[l], counters);
+        print("MLP", numF, hiddenUnits[h], lambdas[l], r);
+        delete fa;
+      }
+    }
+  }
+
+  return 0;
+}
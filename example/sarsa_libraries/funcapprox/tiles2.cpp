@@ -27,6 +27,7 @@ We assume the existence of a function "rand()" that produces successive
 random integers, of which we use only the low-order bytes.
 */
 
+#include <cstring>
 #include <iostream>
 #include <cmath>
 #include "tiles2.h"
@@ -130,16 +131,17 @@ void GetTiles(
 */
 
 
-int hash_UNH(int *ints, int num_ints, long m, int increment)
+static unsigned int rndseq[2048];
+
+/* init_rndseq
+   Fills the table of random numbers on the first call to hashing
+*/
+static void init_rndseq()
 {
-	static unsigned int rndseq[2048];
 	static int first_call =  1;
 	int i,k;
-	long index;
-	long sum = 0;
-	
-	/* if first call to hashing, initialize table of random numbers */
-    if (first_call) {
+
+	if (first_call) {
 		for (k = 0; k < 2048; k++) {
 			rndseq[k] = 0;
 			for (i=0; i < (int) sizeof(int); ++i)
@@ -147,6 +149,18 @@ int hash_UNH(int *ints, int num_ints, long m, int increment)
 		}
 		first_call = 0;
     }
+}
+
+/* unh_sum
+   Sum of the random table entries selected by the integers
+*/
+static long unh_sum(int *ints, int num_ints, int increment)
+{
+	int i;
+	long index;
+	long sum = 0;
+	
+	init_rndseq();
 
 	for (i = 0; i < num_ints; i++) {
 		/* add random table offset for this dimension and wrap around */
@@ -158,6 +172,14 @@ int hash_UNH(int *ints, int num_ints, long m, int increment)
 		/* add selected random number to sum */
 		sum += (long)rndseq[(int)index];
 	}
+	return sum;
+}
+
+int hash_UNH(int *ints, int num_ints, long m, int increment)
+{
+	long index;
+	long sum = unh_sum(ints, num_ints, increment);
+
 	index = (int)(sum % m);
 	while (index < 0) index += m;
 		
@@ -167,26 +189,46 @@ int hash_UNH(int *ints, int num_ints, long m, int increment)
 
 int hash(int *ints, int num_ints, collision_table *ct);
 
+/* claim
+   Stores ccheck into the empty slot j. The table may be shared by several
+   processes, so the slot is taken with compare-and-swap; returns false if
+   another key took it first.
+*/
+static bool claim(collision_table *ct, int j, long ccheck)
+{
+	long prev = __sync_val_compare_and_swap(&ct->data[j], -1L, ccheck);
+	return (prev == -1 || prev == ccheck);
+}
+
 /* hash
    Takes an array of integers and returns the corresponding tile after hashing 
 */
 int hash(int *ints, int num_ints, collision_table *ct)
+{
+	/* the probe step uses the same sum as the index, see ResolveTile */
+	long sum = unh_sum(ints, num_ints, 449);
+	long ccheck = hash_UNH(ints, num_ints, MaxLONGINT, 457);
+	return ResolveTile(ct, sum, ccheck);
+}
+
+/* ResolveTile
+   Finds the tile of a key in the collision table. sum is the (unreduced)
+   UNH sum of the key with increment 449 and ccheck its check value.
+*/
+int ResolveTile(collision_table *ct, long sum, long ccheck)
 {
 	int j;
-	long ccheck;
 
 	ct->calls++;
-	j = hash_UNH(ints, num_ints, ct->m, 449);
-	ccheck = hash_UNH(ints, num_ints, MaxLONGINT, 457);
+	j = (int)(sum % ct->m);
 	if (ccheck == ct->data[j])
 	    ct->clearhits++;
-	else if (ct->data[j] == -1) {
+	else if (ct->data[j] == -1 && claim(ct, j, ccheck))
 		ct->clearhits++;
-	    ct->data[j] = ccheck; }
 	else if (ct->safe == 0)
 		ct->collisions++;
 	else {
-		long h2 = 1 + 2 * hash_UNH(ints,num_ints,(MaxLONGINT)/4,449);
+		long h2 = 1 + 2 * (sum % ((MaxLONGINT)/4));
 		int i = 0;
 		while (++i) {
 			ct->collisions++;
@@ -194,12 +236,71 @@ int hash(int *ints, int num_ints, collision_table *ct)
 			//printf("(%d)",j);
 			if (i > ct->m) {printf("\nOut of Memory"); exit(0);}
 			if (ccheck == ct->data[j]) break;
-			if (ct->data[j] == -1) {ct->data[j] = ccheck; break;}
+			if (ct->data[j] == -1 && claim(ct, j, ccheck)) break;
 		}
 	}			
 	return j;
 }
 
+/* GetTiles1Hashes
+   Computes the collision-free part of GetTiles1(tiles, nt, ct, f[k], h1, h2)
+   for every f[k] (k < num_f) and every h1 (h1 < num_h1) at once: the UNH
+   sum with increment 449 and the check value, stored at
+   [(k * num_h1 + h1) * nt + j] for tiling j. Pass them to ResolveTile in
+   that order to get the same tiles as the sequential calls.
+
+   For one float and two ints the UNH sum is
+     R[coordinate_j] + R[j + inc] + R[h1 + 2 inc] + R[h2 + 3 inc],
+   so the per-tiling and per-h1 terms are computed once and combined. The
+   loops have no branches or loop-carried dependencies, so that the
+   compiler can vectorize them.
+*/
+void GetTiles1Hashes(long sums[], long checks[], int nt,
+                     const float f[], int num_f, int num_h1, int h2)
+{
+	long tiling449[MAX_NUM_TILINGS], tiling457[MAX_NUM_TILINGS];
+	long rest449[MAX_NUM_TILINGS], rest457[MAX_NUM_TILINGS];
+	int coordinates[MAX_NUM_TILINGS];
+	int a, j, k;
+
+	if (nt > MAX_NUM_TILINGS || num_h1 > MAX_NUM_TILINGS) {
+		printf("\nToo many tilings %d %d", nt, num_h1); exit(0);
+	}
+
+	init_rndseq();
+
+	for (a = 0; a < num_h1; a++) {
+		rest449[a] = (long)rndseq[(a + 2 * 449) & 2047] + (long)rndseq[(h2 + 3 * 449) & 2047];
+		rest457[a] = (long)rndseq[(a + 2 * 457) & 2047] + (long)rndseq[(h2 + 3 * 457) & 2047];
+	}
+
+	for (j = 0; j < nt; j++) {
+		tiling449[j] = (long)rndseq[(j + 449) & 2047];
+		tiling457[j] = (long)rndseq[(j + 457) & 2047];
+	}
+
+	for (k = 0; k < num_f; k++) {
+		/* same quantization as GetTiles */
+		int qstate = (int) floor(f[k] * nt);
+
+		/* coordinate of tiling j (base j): qstate - ((qstate - j) mod nt) */
+		for (j = 0; j < nt; j++) {
+			int r = (qstate - j) % nt;
+			coordinates[j] = qstate - r - (r < 0 ? nt : 0);
+		}
+
+		long *s = sums + (long)k * num_h1 * nt;
+		long *c = checks + (long)k * num_h1 * nt;
+		for (a = 0; a < num_h1; a++) {
+			for (j = 0; j < nt; j++) {
+				long r = (long)rndseq[coordinates[j] & 2047];
+				s[a * nt + j] = r + tiling449[j] + rest449[a];
+				c[a * nt + j] = (r + tiling457[j] + rest457[a]) % MaxLONGINT;
+			}
+		}
+	}
+}
+
 void collision_table::reset() {
     for (int i=0; i<m; i++) data[i] = -1;
     calls = 0;
@@ -217,13 +318,24 @@ collision_table::collision_table(int size, int safety) {
     tmp /= 2;
   }
   data = new long[size];
+  own = 1;
   m = size;
   safe = safety;
   reset();
 }
 
+collision_table::collision_table(int size, int safety, long *buffer) {
+  data = buffer;
+  own = 0;
+  m = size;
+  safe = safety;
+  calls = 0;
+  clearhits = 0;
+  collisions = 0;
+}
+
 collision_table::~collision_table() {
-	delete[] data;
+	if (own) delete[] data;
 }
 
 int collision_table::usage() {
@@ -266,6 +378,33 @@ void collision_table::restore(char *fileName, unsigned long pos) {
   file.close();
 }
 
+void collision_table::save(std::string &buffer) {
+
+  buffer.append((char *) &m, sizeof(long));
+  buffer.append((char *) &safe, sizeof(int));
+  buffer.append((char *) &calls, sizeof(long));
+  buffer.append((char *) &clearhits, sizeof(long));
+  buffer.append((char *) &collisions, sizeof(long));
+  buffer.append((char *) data, m*sizeof(long));
+}
+
+bool collision_table::restore(const std::string &buffer, size_t pos) {
+
+  if (buffer.size() < pos + 4*sizeof(long) + sizeof(int) + m*sizeof(long)) return false;
+
+  const char *p = buffer.data() + pos;
+  long size;
+  memcpy(&size, p, sizeof(long));
+  if (size != m) return false;
+  p += sizeof(long);
+  memcpy(&safe, p, sizeof(int));        p += sizeof(int);
+  memcpy(&calls, p, sizeof(long));      p += sizeof(long);
+  memcpy(&clearhits, p, sizeof(long));  p += sizeof(long);
+  memcpy(&collisions, p, sizeof(long)); p += sizeof(long);
+  memcpy(data, p, m*sizeof(long));
+  return true;
+}
+
 /*
 void collision_table::save(char *filename) {
 	write(open(filename, O_BINARY | O_CREAT | O_WRONLY);
@@ -11,12 +11,14 @@
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <string>
 #include <fcntl.h>
 #include <unistd.h>
 
 #define MAX_NUM_VARS 20        // Maximum number of variables in a grid-tiling      
 #define MAX_NUM_COORDS 100     // Maximum number of hashing coordinates      
 #define MaxLONGINT 2147483647  
+#define MAX_NUM_TILINGS 1024   // Maximum number of tilings (and ints) of GetTiles1Hashes
 
 void GetTiles(
 	int tiles[],               // provided array contains returned tiles (tile indices)
@@ -30,9 +32,11 @@ void GetTiles(
 class collision_table {
 public:
     collision_table(int,int);
+    collision_table(int,int,long*); // uses the given storage, which is not cleared
     ~collision_table();
     long m;
     long *data;
+    int own;
     int safe;
     long calls;
     long clearhits;
@@ -41,6 +45,8 @@ public:
     int usage();
     void save(char*, unsigned long);
     void restore(char*, unsigned long);
+    void save(std::string&);                  // appends the same bytes as save(char*, ...)
+    bool restore(const std::string&, size_t); // false if data is too short
 };
 	
 void GetTiles(
@@ -55,6 +61,12 @@ void GetTiles(
 int hash_UNH(int *ints, int num_ints, long m, int increment);
 int hash(int *ints, int num_ints, collision_table *ctable);
 
+// Batched tile coding: hashes of GetTiles1 for many floats and ints at once,
+// then the collision table lookup of each hash (see tiles2.cpp)
+void GetTiles1Hashes(long sums[], long checks[], int nt,
+                     const float f[], int num_f, int num_h1, int h2);
+int ResolveTile(collision_table *ctable, long sum, long ccheck);
+
 // no ints
 void GetTiles(int tiles[],int nt,int memory,float floats[],int nf);
 void GetTiles(int tiles[],int nt,collision_table *ct,float floats[],int nf);
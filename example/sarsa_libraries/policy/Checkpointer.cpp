@@ -0,0 +1,71 @@
+#include "Checkpointer.h"
+#include "WeightFile.h"
+
+Checkpointer::Checkpointer(bool compress){
+
+  this->compress = compress;
+  stopping = false;
+  busy = false;
+  hasPending = false;
+
+  writer = std::thread(&Checkpointer::run, this);
+}
+
+Checkpointer::~Checkpointer(){
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  changed.notify_all();
+  writer.join();
+}
+
+void Checkpointer::save(FunctionApproximator *FA, const char *fileName){
+
+  FA->snapshot(spare);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    pending.swap(spare);
+    pendingFile = fileName;
+    hasPending = true;
+  }
+  changed.notify_all();
+}
+
+void Checkpointer::flush(){
+
+  std::unique_lock<std::mutex> lock(mutex);
+  while(hasPending || busy){
+    changed.wait(lock);
+  }
+}
+
+void Checkpointer::run(){
+
+  std::string fileName;
+  std::unique_lock<std::mutex> lock(mutex);
+
+  while(true){
+
+    while(!hasPending && !stopping){
+      changed.wait(lock);
+    }
+    if(!hasPending){
+      break;// stopping, and everything is written
+    }
+
+    writing.swap(pending);
+    fileName = pendingFile;
+    hasPending = false;
+    busy = true;
+
+    lock.unlock();
+    writeWeightFile(fileName.c_str(), writing, compress);
+    lock.lock();
+
+    busy = false;
+    changed.notify_all();
+  }
+}
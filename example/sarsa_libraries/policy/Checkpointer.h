@@ -0,0 +1,54 @@
+#ifndef CHECKPOINTER_H
+#define CHECKPOINTER_H
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "FuncApprox.h"
+
+// Writes weight files on a background thread, so that the agent never
+// waits for the disk. save() only copies the function approximator into a
+// memory buffer; the buffer is then written to a temporary file that is
+// renamed over the weight file (see WeightFile.h). If a checkpoint is still
+// waiting when the next one is saved, only the newer one is written.
+class Checkpointer{
+
+ private:
+
+  bool compress;
+
+  std::thread writer;
+  std::mutex mutex;
+  std::condition_variable changed;
+  bool stopping;
+  bool busy;          // the writer thread is writing a checkpoint
+  bool hasPending;    // pending holds a checkpoint not yet taken by the writer
+
+  // Three buffers, so that neither side ever waits for the other:
+  // snapshots go into spare (agent thread), are swapped into pending, and
+  // the writer swaps pending into writing.
+  std::string spare;
+  std::string pending;
+  std::string pendingFile;
+  std::string writing;
+
+  void run();
+
+ public:
+
+  // With compress the weight files are gzip-compressed; read() of the
+  // function approximators recognizes both kinds.
+  Checkpointer(bool compress = false);
+  // Writes the last saved checkpoint before returning
+  ~Checkpointer();
+
+  void save(FunctionApproximator *FA, const char *fileName);
+
+  // Waits until every saved checkpoint is on disk
+  void flush();
+
+};
+
+#endif
@@ -16,13 +16,19 @@ PolicyAgent::PolicyAgent(int numFeatures, int numActions, double learningRate, d
   }
 
   toSaveWeights = strlen(saveWeightsFile) > 0;
+  checkpointer = NULL;
   if(toSaveWeights){
     strcpy(this->saveWeightsFile, saveWeightsFile);
+
+    size_t len = strlen(saveWeightsFile);
+    bool compress = len > 3 && strcmp(saveWeightsFile + len - 3, ".gz") == 0;
+    checkpointer = new Checkpointer(compress);
   }
 
 }
 
 PolicyAgent::~PolicyAgent(){
+  delete checkpointer;
 }
 
 int PolicyAgent::getNumFeatures(){ 
@@ -39,7 +45,18 @@ void PolicyAgent::loadWeights(char *fileName){
 }
 
 void PolicyAgent::saveWeights(char *fileName){
-  FA->write(fileName);
+  if(checkpointer != NULL){
+    checkpointer->save(FA, fileName);
+  }
+  else{
+    FA->write(fileName);
+  }
+}
+
+void PolicyAgent::flushWeights(){
+  if(checkpointer != NULL){
+    checkpointer->flush();
+  }
 }
 
 int  PolicyAgent::argmaxQ(double state[]){
@@ -50,3 +67,10 @@ double PolicyAgent::computeQ(double state[], int action){
   return 0;
 }
 
+void PolicyAgent::computeAllQ(double state[], double q[]){
+
+  for(int a = 0; a < getNumActions(); a++){
+    q[a] = computeQ(state, a);
+  }
+}
+
@@ -5,6 +5,7 @@
 #include <fstream>
 #include <iostream>
 #include "FuncApprox.h"
+#include "Checkpointer.h"
 
 #define MAX_STATE_VARS 100
 #define MAX_ACTIONS 10
@@ -26,6 +27,8 @@ class PolicyAgent{
 
   bool toSaveWeights;
   char saveWeightsFile[256];
+  // Writes the weights in the background; a ".gz" saveWeightsFile is compressed
+  Checkpointer *checkpointer;
 
   FunctionApproximator *FA;
 
@@ -35,10 +38,12 @@ class PolicyAgent{
  public:
 
   PolicyAgent(int numFeatures, int numActions, double learningRate, double epsilon, FunctionApproximator *FA, char *loadWeightsFile, char *saveWeightsFile);
-  ~PolicyAgent();
+  virtual ~PolicyAgent();
 
   virtual int  argmaxQ(double state[]);
   virtual double computeQ(double state[], int action);
+  // Fills q[a] = computeQ(state, a) for every action
+  virtual void computeAllQ(double state[], double q[]);
 
   virtual int selectAction(double state[]) = 0;
   
@@ -47,7 +52,10 @@ class PolicyAgent{
   virtual void reset() = 0;
 
   virtual void loadWeights(char *filename);
+  // Returns once the weights are copied; the file is written in the background
   virtual void saveWeights(char *filename);
+  // Waits until the saved weights are on disk
+  void flushWeights();
 
 };
 
@@ -0,0 +1,256 @@
+#include "ReplayAgent.h"
+
+#include <cmath>
+
+ReplayAgent::ReplayAgent(int numFeatures, int numActions, double learningRate, double epsilon,
+                         FunctionApproximator *FA, char *loadWeightsFile, char *saveWeightsFile,
+                         bool backgroundLearner, int capacity, int batchSize,
+                         double batchesPerStep):
+  PolicyAgent(numFeatures, numActions, learningRate, epsilon, FA, loadWeightsFile, saveWeightsFile),
+  buffer(capacity, numFeatures){
+
+  episodeNumber = 0;
+  lastAction = -1;
+  discountFactor = 1;
+
+  this->batchSize = batchSize;
+  this->batchesPerStep = batchesPerStep;
+
+  slots.resize(batchSize);
+  slotGenerations.resize(batchSize);
+  batchStates.resize(batchSize * numFeatures);
+  batchNextStates.resize(batchSize * numFeatures);
+  batchRewards.resize(batchSize);
+  batchActions.resize(batchSize);
+  batchDones.resize(batchSize);
+  probabilities.resize(batchSize);
+  uniforms.resize(batchSize);
+  nextQ.resize(batchSize * numActions);
+  weights.resize(batchSize);
+  rngState[0] = 0x330e;
+  rngState[1] = 0xabcd;
+  rngState[2] = 0x1234;
+
+  pendingBatches = 0;
+  stopping = false;
+  background = backgroundLearner;
+  if(background){
+    learner = std::thread(&ReplayAgent::runLearner, this);
+  }
+}
+
+ReplayAgent::~ReplayAgent(){
+
+  if(background){
+    {
+      std::lock_guard<std::mutex> lock(bufferMutex);
+      stopping = true;
+    }
+    work.notify_all();
+    learner.join();
+  }
+}
+
+int ReplayAgent::argmaxQ(double state[]){
+
+  double Q[MAX_ACTIONS];
+  computeAllQ(state, Q);
+
+  int bestAction = 0;
+  double bestValue = Q[bestAction];
+  int numTies = 0;
+
+  double EPS=1.0e-4;
+
+  for (int a = 1; a < getNumActions(); a++){
+
+    double value = Q[a];
+    if(fabs(value - bestValue) < EPS){
+      numTies++;
+
+      if(drand48() < (1.0 / (numTies + 1))){
+        bestValue = value;
+        bestAction = a;
+      }
+    }
+    else if (value > bestValue){
+      bestValue = value;
+      bestAction = a;
+      numTies = 0;
+    }
+  }
+
+  return bestAction;
+}
+
+double ReplayAgent::computeQ(double state[], int action){
+
+  std::lock_guard<std::mutex> lock(faMutex);
+  FA->setState(state);
+  return FA->computeQ(action);
+}
+
+void ReplayAgent::computeAllQ(double state[], double q[]){
+
+  std::lock_guard<std::mutex> lock(faMutex);
+  FA->setState(state);
+  FA->computeAllQ(q);
+}
+
+int ReplayAgent::selectAction(double state[]){
+
+  if(drand48() < epsilon){
+    return (int)(drand48() * getNumActions()) % getNumActions();
+  }
+  return argmaxQ(state);
+}
+
+// Stores the transition from lastState, and schedules its mini-batches
+void ReplayAgent::store(const double nextState[], bool done){
+
+  bool learnNow = false;
+  {
+    std::lock_guard<std::mutex> lock(bufferMutex);
+    buffer.add(lastState, lastAction, lastReward, nextState, done);
+    if(buffer.size() >= REPLAY_MIN_SIZE && buffer.size() >= batchSize){
+      pendingBatches += batchesPerStep;
+      learnNow = !background;
+    }
+  }
+
+  if(background){
+    work.notify_one();
+  }
+  else if(learnNow){
+    while(pendingBatches >= 1){
+      learnBatch();
+      pendingBatches -= 1;
+    }
+  }
+}
+
+void ReplayAgent::update(double state[], int action, double reward, double discountFactor){
+
+  {
+    std::lock_guard<std::mutex> lock(bufferMutex);
+    this->discountFactor = discountFactor;
+  }
+
+  if(lastAction != -1){
+    store(state, false);
+  }
+
+  for(int i = 0; i < getNumFeatures(); i++){
+    lastState[i] = state[i];
+  }
+  lastAction = action;
+  lastReward = reward;
+}
+
+void ReplayAgent::endEpisode(){
+
+  episodeNumber++;
+  if(lastAction != -1){
+    store(lastState, true);
+  }
+
+  if(toSaveWeights && (episodeNumber + 1) % 5 == 0){
+    saveWeights(saveWeightsFile);
+    std::cout << "Saving weights to " << saveWeightsFile << std::endl;
+  }
+
+  lastAction = -1;
+}
+
+void ReplayAgent::reset(){
+
+  lastAction = -1;
+}
+
+void ReplayAgent::saveWeights(char *fileName){
+
+  std::lock_guard<std::mutex> lock(faMutex);
+  PolicyAgent::saveWeights(fileName);
+}
+
+void ReplayAgent::learnBatch(){
+
+  int numF = getNumFeatures();
+  int numA = getNumActions();
+
+  int size;
+  double gamma;
+  {
+    std::lock_guard<std::mutex> lock(bufferMutex);
+    for(int k = 0; k < batchSize; k++){
+      uniforms[k] = erand48(rngState);
+    }
+    buffer.sample(batchSize, &uniforms[0], &slots[0], &slotGenerations[0],
+                  &batchStates[0], &batchActions[0], &batchRewards[0],
+                  &batchNextStates[0], &batchDones[0], &probabilities[0]);
+    size = buffer.size();
+    gamma = discountFactor;
+  }
+
+  // Importance sampling weights, normalized by the largest
+  double maxWeight = 0;
+  for(int k = 0; k < batchSize; k++){
+    weights[k] = pow(size * probabilities[k], -REPLAY_IMPORTANCE_EXPONENT);
+    if(weights[k] > maxWeight){
+      maxWeight = weights[k];
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(faMutex);
+    FA->computeQBatch(&batchNextStates[0], batchSize, &nextQ[0]);
+  }
+
+  for(int k = 0; k < batchSize; k++){
+
+    double target = batchRewards[k];
+    if(!batchDones[k]){
+      double best = nextQ[k * numA];
+      for(int a = 1; a < numA; a++){
+        if(nextQ[k * numA + a] > best){
+          best = nextQ[k * numA + a];
+        }
+      }
+      target += gamma * best;
+    }
+
+    double delta;
+    {
+      // one sample at a time, so that the agent never waits for a whole batch
+      std::lock_guard<std::mutex> lock(faMutex);
+      FA->setState(&batchStates[k * numF]);
+      delta = target - FA->computeQ(batchActions[k]);
+      FA->decayTraces(0);
+      FA->updateTraces(batchActions[k]);
+      FA->updateWeights(delta * weights[k] / maxWeight, learningRate);
+    }
+
+    // The agent may have replaced the transition while the lock was free
+    std::lock_guard<std::mutex> lock(bufferMutex);
+    buffer.setPriority(slots[k], slotGenerations[k],
+                       pow(fabs(delta) + REPLAY_PRIORITY_EPSILON,
+                           REPLAY_PRIORITY_EXPONENT));
+  }
+}
+
+void ReplayAgent::runLearner(){
+
+  while(true){
+    {
+      std::unique_lock<std::mutex> lock(bufferMutex);
+      while(pendingBatches < 1 && !stopping){
+        work.wait(lock);
+      }
+      if(stopping){
+        return;
+      }
+      pendingBatches -= 1;
+    }
+    learnBatch();
+  }
+}
@@ -0,0 +1,91 @@
+#ifndef REPLAY_AGENT
+#define REPLAY_AGENT
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "PolicyAgent.h"
+#include "ReplayBuffer.h"
+#include "FuncApprox.h"
+
+#define REPLAY_CAPACITY 100000
+#define REPLAY_BATCH_SIZE 32
+#define REPLAY_MIN_SIZE 1000        // transitions stored before learning starts
+#define REPLAY_PRIORITY_EXPONENT 0.6
+#define REPLAY_IMPORTANCE_EXPONENT 0.4
+#define REPLAY_PRIORITY_EPSILON 1.0e-3
+
+// Learns from a prioritized replay buffer of past transitions instead of
+// the online SARSA(lambda) update of SarsaAgent. update() and endEpisode()
+// only store transitions; mini-batches are drawn with probability
+// proportional to |TD error|^REPLAY_PRIORITY_EXPONENT and learned with the
+// Q-learning target r + gamma * max_a Q(s', a), weighted by importance
+// sampling weights. The traces of the function approximator hold the
+// gradient of one sample at a time, so any FunctionApproximator works.
+//
+// With a background learner the mini-batches are learned on a separate
+// thread while the agent keeps playing; otherwise update() learns them
+// itself. Either way about batchesPerStep mini-batches are learned per
+// stored transition.
+class ReplayAgent:public PolicyAgent{
+
+ private:
+
+  int episodeNumber;
+  double lastState[MAX_STATE_VARS];
+  int lastAction;
+  double lastReward;
+  double discountFactor;
+
+  ReplayBuffer buffer;
+  int batchSize;
+  double batchesPerStep;
+
+  // Mini-batch work area of the learner
+  std::vector<int> slots;
+  std::vector<unsigned long> slotGenerations;
+  std::vector<double> batchStates, batchNextStates, batchRewards;
+  std::vector<int> batchActions;
+  std::vector<char> batchDones;
+  std::vector<double> probabilities, uniforms, nextQ, weights;
+  unsigned short rngState[3]; // of the learner, as drand48() is not thread safe
+
+  // faMutex guards FA, bufferMutex the buffer, discountFactor and the
+  // fields below
+  std::mutex faMutex;
+  std::mutex bufferMutex;
+  std::condition_variable work;
+  double pendingBatches;
+  bool stopping;
+  std::thread learner;
+  bool background;
+
+  void store(const double nextState[], bool done);
+  void learnBatch();
+  void runLearner();
+
+ public:
+
+  ReplayAgent(int numFeatures, int numActions, double learningRate, double epsilon,
+              FunctionApproximator *FA, char *loadWeightsFile, char *saveWeightsFile,
+              bool backgroundLearner = true, int capacity = REPLAY_CAPACITY,
+              int batchSize = REPLAY_BATCH_SIZE, double batchesPerStep = 1);
+  ~ReplayAgent();
+
+  int  argmaxQ(double state[]);
+  double computeQ(double state[], int action);
+  void computeAllQ(double state[], double q[]);
+
+  int selectAction(double state[]);
+
+  void update(double state[], int action, double reward, double discountFactor);
+  void endEpisode();
+  void reset();
+
+  void saveWeights(char *filename);
+
+};
+
+#endif
@@ -0,0 +1,136 @@
+#include "ReplayBuffer.h"
+
+#include <cstring>
+
+SumTree::SumTree(int capacity){
+
+  numLeaves = 1;
+  while(numLeaves < capacity){
+    numLeaves *= 2;
+  }
+  nodes.assign(2 * numLeaves, 0.0);
+}
+
+void SumTree::set(int i, double priority){
+
+  // sums are recomputed rather than adjusted, so rounding does not drift
+  int node = numLeaves + i;
+  nodes[node] = priority;
+  for(node /= 2; node >= 1; node /= 2){
+    nodes[node] = nodes[2 * node] + nodes[2 * node + 1];
+  }
+}
+
+double SumTree::get(int i){
+  return nodes[numLeaves + i];
+}
+
+double SumTree::total(){
+  return nodes[1];
+}
+
+int SumTree::find(double u){
+
+  int node = 1;
+  while(node < numLeaves){
+    int left = 2 * node;
+    if(u < nodes[left] || nodes[left + 1] <= 0){
+      node = left;
+    }
+    else{
+      u -= nodes[left];
+      node = left + 1;
+    }
+  }
+  return node - numLeaves;
+}
+
+ReplayBuffer::ReplayBuffer(int capacity, int numFeatures):priorities(capacity){
+
+  this->capacity = capacity;
+  this->numFeatures = numFeatures;
+  next = 0;
+  count = 0;
+  maxPriority = 1.0;
+
+  states.resize((size_t) capacity * numFeatures);
+  nextStates.resize((size_t) capacity * numFeatures);
+  actions.resize(capacity);
+  rewards.resize(capacity);
+  dones.resize(capacity);
+  generations.resize(capacity, 0);
+}
+
+int ReplayBuffer::size(){
+  return count;
+}
+
+double ReplayBuffer::totalPriority(){
+  return priorities.total();
+}
+
+int ReplayBuffer::add(const double state[], int action, double reward,
+                      const double nextState[], bool done){
+
+  int slot = next;
+  size_t row = (size_t) slot * numFeatures;
+  memcpy(&states[row], state, numFeatures * sizeof(double));
+  if(done){
+    memset(&nextStates[row], 0, numFeatures * sizeof(double));
+  }
+  else{
+    memcpy(&nextStates[row], nextState, numFeatures * sizeof(double));
+  }
+  actions[slot] = action;
+  rewards[slot] = reward;
+  dones[slot] = done;
+  generations[slot]++;
+  priorities.set(slot, maxPriority);
+
+  next = (next + 1) % capacity;
+  if(count < capacity){
+    count++;
+  }
+  return slot;
+}
+
+void ReplayBuffer::sample(int n, const double u[], int slots[],
+                          unsigned long slotGenerations[],
+                          double batchStates[], int batchActions[],
+                          double batchRewards[], double batchNextStates[],
+                          char batchDones[], double probabilities[]){
+
+  double total = priorities.total();
+  double segment = total / n;
+
+  for(int k = 0; k < n; k++){
+
+    int slot = priorities.find((k + u[k]) * segment);
+    if(slot >= count){
+      slot = count - 1; // rounding at the end of the tree
+    }
+    slots[k] = slot;
+    slotGenerations[k] = generations[slot];
+
+    size_t row = (size_t) slot * numFeatures;
+    memcpy(&batchStates[k * numFeatures], &states[row], numFeatures * sizeof(double));
+    memcpy(&batchNextStates[k * numFeatures], &nextStates[row], numFeatures * sizeof(double));
+    batchActions[k] = actions[slot];
+    batchRewards[k] = rewards[slot];
+    batchDones[k] = dones[slot];
+    probabilities[k] = priorities.get(slot) / total;
+  }
+}
+
+bool ReplayBuffer::setPriority(int slot, unsigned long generation,
+                               double priority){
+
+  if(generations[slot] != generation){
+    return false;
+  }
+  priorities.set(slot, priority);
+  if(priority > maxPriority){
+    maxPriority = priority;
+  }
+  return true;
+}
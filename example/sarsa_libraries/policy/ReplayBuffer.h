@@ -0,0 +1,81 @@
+#ifndef REPLAY_BUFFER_H
+#define REPLAY_BUFFER_H
+
+#include <vector>
+
+// Binary tree of priorities, each node holding the sum of its children,
+// so that a transition can be drawn with probability proportional to its
+// priority in O(log n).
+class SumTree{
+
+ private:
+
+  int numLeaves;            // a power of 2
+  std::vector<double> nodes; // nodes[1] is the root, leaves start at numLeaves
+
+ public:
+
+  SumTree(int capacity);
+
+  void set(int i, double priority);
+  double get(int i);
+  double total();
+  // Index of the leaf where the running sum of the priorities reaches u,
+  // 0 <= u < total()
+  int find(double u);
+
+};
+
+// Ring buffer of transitions (state, action, reward, next state, done),
+// stored as one contiguous array per field, with a priority per transition
+// for prioritized sampling. Once full, the oldest transition is replaced.
+class ReplayBuffer{
+
+ private:
+
+  int capacity;
+  int numFeatures;
+  int next;    // slot of the next transition
+  int count;   // number of stored transitions
+
+  std::vector<double> states;     // capacity rows of numFeatures values
+  std::vector<double> nextStates; // capacity rows of numFeatures values
+  std::vector<int> actions;
+  std::vector<double> rewards;
+  std::vector<char> dones;
+  std::vector<unsigned long> generations; // times each slot was written
+
+  SumTree priorities;
+  double maxPriority;
+
+ public:
+
+  ReplayBuffer(int capacity, int numFeatures);
+
+  int size();
+  double totalPriority();
+
+  // Stores a transition with the highest priority seen so far, so that it
+  // is replayed at least once soon. Returns its slot.
+  int add(const double state[], int action, double reward,
+          const double nextState[], bool done);
+
+  // Draws n slots with probability proportional to their priority, one in
+  // each of n equal parts of the total priority. u holds n uniform numbers
+  // in [0, 1). The transitions are copied into the batch arrays,
+  // probabilities[k] receives the sampling probability of slots[k] and
+  // slotGenerations[k] its write generation, for setPriority().
+  void sample(int n, const double u[], int slots[],
+              unsigned long slotGenerations[], double batchStates[],
+              int batchActions[], double batchRewards[],
+              double batchNextStates[], char batchDones[],
+              double probabilities[]);
+
+  // Sets the priority of the transition sampled from slot, unless add()
+  // has replaced it since (the new transition keeps its priority).
+  // Returns false in that case.
+  bool setPriority(int slot, unsigned long generation, double priority);
+
+};
+
+#endif
@@ -96,11 +96,7 @@ int SarsaAgent::argmaxQ(double state[]){
   
   double Q[getNumActions()];
 
-  FA->setState(state);
-
-  for(int i = 0; i < getNumActions(); i++){
-    Q[i] = FA->computeQ(i);
-  }
+  computeAllQ(state, Q);
   
   int bestAction = 0;
   double bestValue = Q[bestAction];
@@ -129,6 +125,13 @@ int SarsaAgent::argmaxQ(double state[]){
   return bestAction;
 }
 
+//Be careful. This resets FA->state.
+void SarsaAgent::computeAllQ(double state[], double q[]){
+
+  FA->setState(state);
+  FA->computeAllQ(q);
+}
+
 //Be careful. This resets FA->state.
 double SarsaAgent::computeQ(double state[], int action){
 
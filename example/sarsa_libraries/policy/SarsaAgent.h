@@ -20,6 +20,7 @@ class SarsaAgent:public PolicyAgent{
 
   int  argmaxQ(double state[]);
   double computeQ(double state[], int action);
+  void computeAllQ(double state[], double q[]);
 
   int selectAction(double state[]);
 
@@ -2,16 +2,44 @@
 #define __FA_C_WRAPPER_H__
 
 #include "CMAC.h"
+#include "SharedCMAC.h"
+#include "MLP.h"
 #include<iostream>
 
+// Function approximators are passed around as FunctionApproximator*
+// converted to void*, so that the agent wrappers accept any of them.
 extern "C" {
-  void* CMAC_new(int numF, int numA, double r[], double m[], double res[]) 
+  void* CMAC_new(int numF, int numA, double r[], double m[], double res[],
+                 int memorySize)
   {
 //    std::cout<<"FA_C_WRAPPER: CMAC_new"<<std::endl;
-    CMAC *ca = new CMAC(numF, numA, r, m, res);
+    FunctionApproximator *ca = new CMAC(numF, numA, r, m, res, memorySize);
     void *ptr = reinterpret_cast<void *>(ca);
     return ptr;
   }
+  void* SharedCMAC_new(int numF, int numA, double r[], double m[], double res[],
+                       char *name, bool atomicUpdates, int memorySize)
+  {
+    FunctionApproximator *ca = new SharedCMAC(numF, numA, r, m, res, name, atomicUpdates,
+                              memorySize);
+    void *ptr = reinterpret_cast<void *>(ca);
+    return ptr;
+  }
+  void SharedCMAC_unlink(char *name)
+  {
+    SharedCMAC::unlink(name);
+  }
+  void* MLP_new(int numF, int numA, double r[], double m[], int numHidden)
+  {
+    FunctionApproximator *fa = new MLP(numF, numA, r, m, numHidden);
+    void *ptr = reinterpret_cast<void *>(fa);
+    return ptr;
+  }
+  void FA_computeQBatch(void *ptr, double states[], int numStates, double q[])
+  {
+    FunctionApproximator *fa = reinterpret_cast<FunctionApproximator *>(ptr);
+    fa->computeQBatch(states, numStates, q);
+  }
 }
 
 #endif
@@ -2,33 +2,79 @@
 #define __POLICY_C_WRAPPER_H__
 
 #include "SarsaAgent.h"
+#include "ReplayAgent.h"
 #include "FuncApprox.h"
-#include "CMAC.h"
 #include<iostream>
 
+// Agents are passed around as PolicyAgent* converted to void*; the
+// SarsaAgent_ functions below work on any of them.
 extern "C" {
   void* SarsaAgent_new(int numFeatures, int numActions, double learningRate, double epsilon, double lambda, void *FA, char *loadWeightsFile, char *saveWeightsFile)
   {
-    CMAC *fa = reinterpret_cast<CMAC *>(FA);
-    SarsaAgent *sa=new SarsaAgent(numFeatures, numActions, learningRate, epsilon, lambda, fa, loadWeightsFile, saveWeightsFile);
+    FunctionApproximator *fa = reinterpret_cast<FunctionApproximator *>(FA);
+    PolicyAgent *sa=new SarsaAgent(numFeatures, numActions, learningRate, epsilon, lambda, fa, loadWeightsFile, saveWeightsFile);
     void *ptr = reinterpret_cast<void *>(sa);
     return ptr; 
   }
+  void* ReplayAgent_new(int numFeatures, int numActions, double learningRate, double epsilon, void *FA, char *loadWeightsFile, char *saveWeightsFile, bool backgroundLearner, int capacity, int batchSize, double batchesPerStep)
+  {
+    FunctionApproximator *fa = reinterpret_cast<FunctionApproximator *>(FA);
+    PolicyAgent *ra=new ReplayAgent(numFeatures, numActions, learningRate, epsilon, fa, loadWeightsFile, saveWeightsFile, backgroundLearner, capacity, batchSize, batchesPerStep);
+    void *ptr = reinterpret_cast<void *>(ra);
+    return ptr;
+  }
   void SarsaAgent_update(void *ptr, double state[], int action, double reward, double discountFactor)
   {
-    SarsaAgent *p = reinterpret_cast<SarsaAgent *>(ptr);
+    PolicyAgent *p = reinterpret_cast<PolicyAgent *>(ptr);
     p->update(state,action,reward,discountFactor); 
   }
   int SarsaAgent_selectAction(void *ptr, double state[])
   {
-    SarsaAgent *p = reinterpret_cast<SarsaAgent *>(ptr);
+    PolicyAgent *p = reinterpret_cast<PolicyAgent *>(ptr);
     int action=p->selectAction(state);
     return action;
   }
   void SarsaAgent_endEpisode(void *ptr) 
   {
-    SarsaAgent *p = reinterpret_cast<SarsaAgent *>(ptr);
+    PolicyAgent *p = reinterpret_cast<PolicyAgent *>(ptr);
     p->endEpisode();
   }
+  // Batched entry points. states holds one row of numFeatures values per
+  // agent or transition.
+
+  // actions[i] = agents[i]->selectAction(states row i)
+  void SarsaAgent_selectActions(void *agents[], int numAgents, int numFeatures,
+                                double states[], int actions[])
+  {
+    for(int i = 0; i < numAgents; i++){
+      PolicyAgent *p = reinterpret_cast<PolicyAgent *>(agents[i]);
+      actions[i] = p->selectAction(&states[i * numFeatures]);
+    }
+  }
+  // agents[i]->update(states row i, actions[i], rewards[i], discountFactor)
+  void SarsaAgent_updateAgents(void *agents[], int numAgents, int numFeatures,
+                               double states[], int actions[], double rewards[],
+                               double discountFactor)
+  {
+    for(int i = 0; i < numAgents; i++){
+      PolicyAgent *p = reinterpret_cast<PolicyAgent *>(agents[i]);
+      p->update(&states[i * numFeatures], actions[i], rewards[i], discountFactor);
+    }
+  }
+  // Applies numTransitions consecutive updates of one agent
+  void SarsaAgent_updateBatch(void *ptr, int numTransitions, int numFeatures,
+                              double states[], int actions[], double rewards[],
+                              double discountFactor)
+  {
+    PolicyAgent *p = reinterpret_cast<PolicyAgent *>(ptr);
+    for(int i = 0; i < numTransitions; i++){
+      p->update(&states[i * numFeatures], actions[i], rewards[i], discountFactor);
+    }
+  }
+  void SarsaAgent_flushWeights(void *ptr)
+  {
+    PolicyAgent *p = reinterpret_cast<PolicyAgent *>(ptr);
+    p->flushWeights();
+  }
 }
 #endif
@@ -10,33 +10,130 @@ if sys.version_info[0] == 3:
 username=getpass.getuser()
 
 
+# Default number of CMAC weights, see CMAC.h
+RL_MEMORY_SIZE=1048576
+
 libs = cdll.LoadLibrary(os.path.join(os.path.dirname(__file__),'C_wrappers.so'))
 
-libs.CMAC_new.argtypes=[c_int,c_int,POINTER(c_double),POINTER(c_double),POINTER(c_double)]
+libs.CMAC_new.argtypes=[c_int,c_int,POINTER(c_double),POINTER(c_double),POINTER(c_double),c_int]
 libs.CMAC_new.restype=c_void_p
 
+libs.SharedCMAC_new.argtypes=[c_int,c_int,POINTER(c_double),POINTER(c_double),POINTER(c_double),c_char_p,c_bool,c_int]
+libs.SharedCMAC_new.restype=c_void_p
+
+libs.SharedCMAC_unlink.argtypes=[c_char_p]
+libs.SharedCMAC_unlink.restype=None
+
 libs.SarsaAgent_new.argtypes=[c_int,c_int,c_double,c_double,c_double,c_void_p,c_char_p,c_char_p]
 libs.SarsaAgent_new.restype=c_void_p
 
-libs.SarsaAgent_update.argtypes=[c_void_p,POINTER(c_double),c_int,c_double,c_double]
+libs.ReplayAgent_new.argtypes=[c_int,c_int,c_double,c_double,c_void_p,c_char_p,c_char_p,c_bool,c_int,c_int,c_double]
+libs.ReplayAgent_new.restype=c_void_p
+
+# States are passed as numpy float64 arrays, without copying when they
+# already are C-contiguous float64 arrays (see _doubles)
+DoubleArray=np.ctypeslib.ndpointer(dtype=np.float64,flags='C_CONTIGUOUS')
+IntArray=np.ctypeslib.ndpointer(dtype=np.int32,flags='C_CONTIGUOUS')
+
+libs.MLP_new.argtypes=[c_int,c_int,POINTER(c_double),POINTER(c_double),c_int]
+libs.MLP_new.restype=c_void_p
+
+libs.FA_computeQBatch.argtypes=[c_void_p,DoubleArray,c_int,DoubleArray]
+libs.FA_computeQBatch.restype=None
+
+libs.SarsaAgent_update.argtypes=[c_void_p,DoubleArray,c_int,c_double,c_double]
 libs.SarsaAgent_update.restype=None
 
-libs.SarsaAgent_selectAction.argtypes=[c_void_p,POINTER(c_double)]
+libs.SarsaAgent_selectAction.argtypes=[c_void_p,DoubleArray]
 libs.SarsaAgent_selectAction.restype=c_int
 
 libs.SarsaAgent_endEpisode.argtypes=[c_void_p]
 libs.SarsaAgent_endEpisode.restype=None
 
+libs.SarsaAgent_selectActions.argtypes=[POINTER(c_void_p),c_int,c_int,DoubleArray,IntArray]
+libs.SarsaAgent_selectActions.restype=None
+
+libs.SarsaAgent_updateAgents.argtypes=[POINTER(c_void_p),c_int,c_int,DoubleArray,IntArray,DoubleArray,c_double]
+libs.SarsaAgent_updateAgents.restype=None
+
+libs.SarsaAgent_updateBatch.argtypes=[c_void_p,c_int,c_int,DoubleArray,IntArray,DoubleArray,c_double]
+libs.SarsaAgent_updateBatch.restype=None
+
+libs.SarsaAgent_flushWeights.argtypes=[c_void_p]
+libs.SarsaAgent_flushWeights.restype=None
+
+def _doubles(x):
+  # no copy if x already is a C-contiguous float64 array
+  return np.ascontiguousarray(x,dtype=np.float64)
+
+def _ints(x):
+  return np.ascontiguousarray(x,dtype=np.int32)
+
+def _rows(x,numColumns):
+  # (n, numColumns) float64 array, n = 1 for a single state
+  return _doubles(x).reshape(-1,numColumns)
+
+def _checkLength(name,x,n):
+  if len(x) != n:
+    raise ValueError('%s has %d entries, expected %d' % (name,len(x),n))
+
+def _checkAgents(agents):
+  if len(agents) == 0:
+    raise ValueError('no agents given')
+
 
-class CMAC(object):
+class FunctionApproximator(object):
 
-  def __init__(self,numF,numA,r,m,res):
+  def computeQBatch(self,states):
+    """ Q values of an (n, numF) array of states, as an (n, numA) array """
+    s = _rows(states,self.numF)
+    q = np.empty((s.shape[0],self.numA))
+    libs.FA_computeQBatch(c_void_p(self.obj),s,s.shape[0],q)
+    return q
+
+class CMAC(FunctionApproximator):
+
+  # memorySize is the number of weights and must be a power of 2
+  def __init__(self,numF,numA,r,m,res,memorySize=RL_MEMORY_SIZE):
     arr1 = (c_double * len(r))(*r)
     arr2 = (c_double * len(m))(*m)
     arr3 = (c_double * len(res))(*res)
-    self.obj = libs.CMAC_new(c_int(numF),c_int(numA),arr1,arr2,arr3)
+    self.numF = numF
+    self.numA = numA
+    self.obj = libs.CMAC_new(c_int(numF),c_int(numA),arr1,arr2,arr3,c_int(memorySize))
     #print(self.obj)
 
+class SharedCMAC(CMAC):
+  """ CMAC whose weights live in the shared-memory object name (e.g.
+  '/hfo_sarsa'), shared by all agents on the host that use the same name """
+
+  def __init__(self,numF,numA,r,m,res,name,atomicUpdates=False,memorySize=RL_MEMORY_SIZE):
+    arr1 = (c_double * len(r))(*r)
+    arr2 = (c_double * len(m))(*m)
+    arr3 = (c_double * len(res))(*res)
+    if isPy3:
+      name=name.encode('utf-8')
+    self.numF = numF
+    self.numA = numA
+    self.obj = libs.SharedCMAC_new(c_int(numF),c_int(numA),arr1,arr2,arr3,c_char_p(name),c_bool(atomicUpdates),c_int(memorySize))
+
+  @staticmethod
+  def unlink(name):
+    if isPy3:
+      name=name.encode('utf-8')
+    libs.SharedCMAC_unlink(c_char_p(name))
+
+class MLP(FunctionApproximator):
+  """ Neural network with numHidden tanh units, for many continuous
+  features; r and m are the range and minimum of each feature """
+
+  def __init__(self,numF,numA,r,m,numHidden=64):
+    arr1 = (c_double * len(r))(*r)
+    arr2 = (c_double * len(m))(*m)
+    self.numF = numF
+    self.numA = numA
+    self.obj = libs.MLP_new(c_int(numF),c_int(numA),arr1,arr2,c_int(numHidden))
+
 class SarsaAgent(object):
 
   def __init__(self,numFeatures, numActions, learningRate, epsilon, Lambda, FA, loadWeightsFile, saveWeightsFile):
@@ -54,11 +151,13 @@ class SarsaAgent(object):
     #non encoded will do for python2
       p7=c_char_p(loadWeightsFile)
       p8=c_char_p(saveWeightsFile)
+    self.numFeatures = numFeatures
     self.obj = libs.SarsaAgent_new(p1,p2,p3,p4,p5,p6,p7,p8)
     #print(format(self.obj,'02x'))
 
   def update(self,state,action,reward,discountFactor):
-    s = (c_double * len(state))(*state)
+    s = _doubles(state).ravel()
+    _checkLength('state',s,self.numFeatures)
     a = c_int(action)
     r = c_double(reward)
     df = c_double(discountFactor)
@@ -66,7 +165,8 @@ class SarsaAgent(object):
     #print(format(self.obj,'02x'))
 
   def selectAction(self,state):
-    s = (c_double * len(state))(*state)
+    s = _doubles(state).ravel()
+    _checkLength('state',s,self.numFeatures)
     action=libs.SarsaAgent_selectAction(c_void_p(self.obj),s)
     #print(action)
     #print(format(self.obj,'02x'))
@@ -75,9 +175,59 @@ class SarsaAgent(object):
   def endEpisode(self):
     libs.SarsaAgent_endEpisode(c_void_p(self.obj))
     #print(format(self.obj,'02x'))
-    
-    
-     
 
-
-    
+  def updateBatch(self,states,actions,rewards,discountFactor):
+    """ Same as update() on each row of states with the matching action
+    and reward, in order """
+    s = _rows(states,self.numFeatures)
+    a = _ints(actions)
+    r = _doubles(rewards)
+    _checkLength('actions',a,s.shape[0])
+    _checkLength('rewards',r,s.shape[0])
+    libs.SarsaAgent_updateBatch(c_void_p(self.obj),s.shape[0],self.numFeatures,s,a,r,c_double(discountFactor))
+
+  @staticmethod
+  def _pointers(agents):
+    return (c_void_p * len(agents))(*[a.obj for a in agents])
+
+  @staticmethod
+  def selectActions(agents,states):
+    """ Actions of several agents, agents[i] choosing for row i of states.
+    The agents must have the same number of features. """
+    _checkAgents(agents)
+    s = _rows(states,agents[0].numFeatures)
+    _checkLength('states',s,len(agents))
+    actions = np.empty(len(agents),dtype=np.int32)
+    libs.SarsaAgent_selectActions(SarsaAgent._pointers(agents),len(agents),agents[0].numFeatures,s,actions)
+    return actions
+
+  @staticmethod
+  def updateAgents(agents,states,actions,rewards,discountFactor):
+    """ agents[i].update(states[i], actions[i], rewards[i], discountFactor) """
+    _checkAgents(agents)
+    s = _rows(states,agents[0].numFeatures)
+    a = _ints(actions)
+    r = _doubles(rewards)
+    _checkLength('states',s,len(agents))
+    _checkLength('actions',a,len(agents))
+    _checkLength('rewards',r,len(agents))
+    libs.SarsaAgent_updateAgents(SarsaAgent._pointers(agents),len(agents),agents[0].numFeatures,s,a,r,c_double(discountFactor))
+
+  def flushWeights(self):
+    # weights are saved in the background; wait until they are on disk
+    libs.SarsaAgent_flushWeights(c_void_p(self.obj))
+
+class ReplayAgent(SarsaAgent):
+  """ Learns from a prioritized replay buffer, on a background thread if
+  backgroundLearner is set; same interface as SarsaAgent """
+
+  def __init__(self,numFeatures, numActions, learningRate, epsilon, FA, loadWeightsFile, saveWeightsFile,
+               backgroundLearner=True, capacity=100000, batchSize=32, batchesPerStep=1.0):
+    if isPy3:
+      loadWeightsFile=loadWeightsFile.encode('utf-8')
+      saveWeightsFile=saveWeightsFile.encode('utf-8')
+    self.numFeatures = numFeatures
+    self.obj = libs.ReplayAgent_new(c_int(numFeatures),c_int(numActions),c_double(learningRate),
+                                    c_double(epsilon),c_void_p(FA.obj),c_char_p(loadWeightsFile),
+                                    c_char_p(saveWeightsFile),c_bool(backgroundLearner),
+                                    c_int(capacity),c_int(batchSize),c_double(batchesPerStep))
@@ -0,0 +1,295 @@
+#include <iostream>
+#include <vector>
+#include <HFO.hpp>
+#include <cstdlib>
+#include <thread>
+#include "SarsaAgent.h"
+#include "CMAC.h"
+#include "offense_features.h"
+#include "defense_features.h"
+#include <unistd.h>
+
+// Runs the offense and defense SARSA learners of one game in a single
+// process, instead of one high_level_sarsa_agent and one
+// high_level_sarsa_defense_agent process per team. Each learner has its
+// own HFOEnvironment and thread: step() blocks until the server sends the
+// next cycle, which in synch mode only happens once every player has
+// acted, so the learners cannot take turns on fewer threads.
+//
+// With --shareWeights all learners of a team learn into one weight table,
+// so a team keeps a single CMAC table in memory instead of one per learner.
+//
+// Before running this program, first Start HFO server:
+// $./bin/HFO --offense-agents numOffense --defense-agents numDefense
+
+void printUsage() {
+  std::cout<<"Usage: ./high_level_sarsa_multi_agent [Options]"<<std::endl;
+  std::cout<<"Options:"<<std::endl;
+  std::cout<<"  --numOffense <int>       Number of offense SARSA agents"<<std::endl;
+  std::cout<<"                           Default: 1"<<std::endl;
+  std::cout<<"  --numDefense <int>       Number of defense SARSA agents"<<std::endl;
+  std::cout<<"                           Default: 0"<<std::endl;
+  std::cout<<"  --offenseNpcs <int>      Number of offense npcs in the game"<<std::endl;
+  std::cout<<"                           Default: 0"<<std::endl;
+  std::cout<<"  --defenseNpcs <int>      Number of defense npcs in the game"<<std::endl;
+  std::cout<<"                           Default: 0"<<std::endl;
+  std::cout<<"  --numEpisodes <int>      Number of episodes to run"<<std::endl;
+  std::cout<<"                           Default: 10"<<std::endl;
+  std::cout<<"  --port <int>             HFO server port"<<std::endl;
+  std::cout<<"                           Default: 6000"<<std::endl;
+  std::cout<<"  --learnRate <float>      Learning rate of SARSA agents"<<std::endl;
+  std::cout<<"                           Range: [0.0, 1.0]"<<std::endl;
+  std::cout<<"                           Default: 0.1"<<std::endl;
+  std::cout<<"  --eps <float>            Exploration rate"<<std::endl;
+  std::cout<<"                           Default: 0.01"<<std::endl;
+  std::cout<<"  --step <int>             Persistent step size of defense agents"<<std::endl;
+  std::cout<<"                           Default: 10"<<std::endl;
+  std::cout<<"  --suffix <int>           Suffix for weights files"<<std::endl;
+  std::cout<<"                           Default: 0"<<std::endl;
+  std::cout<<"  --shareWeights           Agents of a team learn into one weight table"<<std::endl;
+  std::cout<<"  --help                   Displays this help and exit"<<std::endl;
+}
+
+// Settings of one learner
+struct Learner {
+  bool offense;
+  int numTMates;
+  int numOpponents;
+  std::string wtFile; // empty if the learner neither reads nor writes weights
+  CMAC *fa;
+  SarsaAgent *sa;
+};
+
+// Same loop as offenseAgent() of high_level_sarsa_agent.cpp
+void offenseLearner(Learner *l, int port, int numEpi) {
+
+  using namespace offense;
+
+  bool oppPres = l->numOpponents > 0;
+  int numF = numFeatures(l->numTMates, oppPres);
+  double discFac = 1;
+
+  hfo::HFOEnvironment hfo;
+  hfo::status_t status = hfo::IN_GAME;
+  hfo::action_t a;
+  double state[numF];
+  int action = -1;
+  double reward;
+  hfo.connectToServer(hfo::HIGH_LEVEL_FEATURE_SET,"../../bin/teams/base/config/formations-dt",port,"localhost","base_left",false,"");
+  hfo.addReward(hfo::GOAL_REWARD);
+  for (int episode=0; episode < numEpi && status != hfo::SERVER_DOWN; episode++) {
+    status = hfo::IN_GAME;
+    action = -1;
+    while (status == hfo::IN_GAME) {
+      const std::vector<float>& state_vec = hfo.getState();
+      // If has ball
+      if(state_vec[5] == 1) {
+        if(action != -1) {
+          reward = hfo.getReward();
+          l->sa->update(state, action, reward, discFac);
+        }
+        purgeFeatures(state, state_vec, l->numTMates, oppPres);
+        action = l->sa->selectAction(state);
+        a = toAction(action, state_vec);
+      } else {
+        a = hfo::MOVE;
+      }
+      if (a == hfo::PASS) {
+        hfo.act(a,state_vec[(9+6*l->numTMates) - (action-2)*3]);
+      } else {
+        hfo.act(a);
+      }
+      status = hfo.step();
+    }
+    // End of episode
+    if(action != -1) {
+      reward = hfo.getReward();
+      l->sa->update(state, action, reward, discFac);
+      l->sa->endEpisode();
+    }
+  }
+  hfo.act(hfo::QUIT);
+}
+
+// Same loop as offenseAgent() of high_level_sarsa_defense_agent.cpp
+void defenseLearner(Learner *l, int port, int numEpi, int step) {
+
+  using namespace defense;
+
+  int numF = numFeatures(l->numTMates, l->numOpponents, true);
+  double discFac = 1;
+
+  hfo::HFOEnvironment hfo;
+  hfo::status_t status = hfo::IN_GAME;
+  hfo::action_t a = hfo::NOOP;
+  double state[numF];
+  int action = -1;
+  double reward;
+  hfo.connectToServer(hfo::HIGH_LEVEL_FEATURE_SET,"../../bin/teams/base/config/formations-dt",port,"localhost","base_right",false,"");
+  hfo.addReward(hfo::GOAL_REWARD);
+  for (int episode=0; episode < numEpi && status != hfo::SERVER_DOWN; episode++) {
+    status = hfo::IN_GAME;
+    action = -1;
+    int count_steps = 0;
+    double unum = -1;
+    const std::vector<float>& state_vec = hfo.getState();
+    while (status == hfo::IN_GAME) {
+      // Repeat the last action for step cycles
+      if (count_steps != step && action >= 0 && (a != hfo::MARK_PLAYER || unum > 0)) {
+        count_steps++;
+        if (a == hfo::MARK_PLAYER) {
+          hfo.act(a,unum);
+        } else {
+          hfo.act(a);
+        }
+        status = hfo.step();
+        continue;
+      } else {
+        count_steps = 0;
+      }
+
+      if(action != -1) {
+        reward = hfo.getReward();
+        l->sa->update(state, action, reward, discFac);
+      }
+      purgeFeatures(state, state_vec, l->numTMates, l->numOpponents, true);
+      action = l->sa->selectAction(state);
+      a = toAction(action, state_vec);
+      if (a == hfo::MARK_PLAYER) {
+        unum = state_vec[(state_vec.size()-1 -2 - (action-5)*3)];
+        hfo.act(a,unum);
+      } else {
+        hfo.act(a);
+      }
+      status = hfo.step();
+    }
+    // End of episode
+    if(action != -1) {
+      reward = hfo.getReward();
+      l->sa->update(state, action, reward, discFac);
+      l->sa->endEpisode();
+    }
+  }
+  hfo.act(hfo::QUIT);
+}
+
+int main(int argc, char **argv) {
+
+  int numOffense = 1;
+  int numDefense = 0;
+  int offenseNpcs = 0;
+  int defenseNpcs = 0;
+  int numEpisodes = 10;
+  int port = 6000;
+  double learnR = 0.1;
+  double eps = 0.01;
+  int step = 10;
+  int suffix = 0;
+  bool shareWeights = false;
+  for(int i = 1; i < argc; i++) {
+    std::string param = std::string(argv[i]);
+    if(param == "--numOffense") {
+      numOffense = atoi(argv[++i]);
+    }else if(param == "--numDefense") {
+      numDefense = atoi(argv[++i]);
+    }else if(param == "--offenseNpcs") {
+      offenseNpcs = atoi(argv[++i]);
+    }else if(param == "--defenseNpcs") {
+      defenseNpcs = atoi(argv[++i]);
+    }else if(param == "--numEpisodes") {
+      numEpisodes = atoi(argv[++i]);
+    }else if(param == "--port") {
+      port = atoi(argv[++i]);
+    }else if(param == "--learnRate") {
+      learnR = atof(argv[++i]);
+      if(learnR < 0 || learnR > 1) {
+        printUsage();
+        return 0;
+      }
+    }else if(param == "--eps") {
+      eps = atof(argv[++i]);
+    }else if(param == "--step") {
+      step = atoi(argv[++i]);
+    }else if(param == "--suffix") {
+      suffix = atoi(argv[++i]);
+    }else if(param == "--shareWeights") {
+      shareWeights = true;
+    }else {
+      printUsage();
+      return 0;
+    }
+  }
+
+  int numOffensePlayers = numOffense + offenseNpcs;
+  int numDefensePlayers = numDefense + defenseNpcs;
+
+  // Tile coding parameter
+  double resolution = 0.1;
+  double range[MAX_STATE_VARS];
+  double min[MAX_STATE_VARS];
+  double res[MAX_STATE_VARS];
+  for(int i = 0; i < MAX_STATE_VARS; i++) {
+    min[i] = -1;
+    range[i] = 2;
+    res[i] = resolution;
+  }
+
+  // All function approximators are created before the learners start, as
+  // CMAC initializes the global tile hashing tables
+  std::vector<Learner> learners(numOffense + numDefense);
+  for(int i = 0; i < (int) learners.size(); i++) {
+    Learner &l = learners[i];
+    l.offense = i < numOffense;
+    int index = l.offense ? i : i - numOffense;
+    int numF, numA;
+    double lambda;
+    if(l.offense) {
+      l.numTMates = numOffensePlayers - 1;
+      l.numOpponents = numDefensePlayers;
+      numF = offense::numFeatures(l.numTMates, l.numOpponents > 0);
+      numA = offense::numActions(l.numTMates);
+      lambda = 0;
+    } else {
+      l.numTMates = numDefensePlayers - 1;
+      l.numOpponents = numOffensePlayers;
+      numF = defense::numFeatures(l.numTMates, l.numOpponents, true);
+      numA = defense::numActions(l.numOpponents);
+      lambda = 0.9375;
+    }
+
+    // With shared weights the first learner of a team owns the table and
+    // is the only one to read and write the weights file
+    Learner *owner = shareWeights && index > 0 ? &learners[i - index] : NULL;
+    if(owner == NULL) {
+      l.fa = new CMAC(numF, numA, range, min, res);
+      l.wtFile = std::string(l.offense ? "weights_offense_" : "weights_defense_")
+        + std::to_string(index) + "_" + std::to_string(suffix);
+    } else {
+      l.fa = new CMAC(owner->fa);
+    }
+    l.sa = new SarsaAgent(numF, numA, learnR, eps, lambda, l.fa,
+                          &l.wtFile[0u], &l.wtFile[0u]);
+  }
+
+  std::vector<std::thread> threads;
+  for(int i = 0; i < (int) learners.size(); i++) {
+    if(learners[i].offense) {
+      threads.push_back(std::thread(offenseLearner, &learners[i], port,
+                                    numEpisodes));
+    } else {
+      threads.push_back(std::thread(defenseLearner, &learners[i], port,
+                                    numEpisodes, step));
+    }
+    usleep(500000L);
+  }
+  for(int i = 0; i < (int) threads.size(); i++) {
+    threads[i].join();
+  }
+
+  // Shared tables are deleted after the CMACs that use them
+  for(int i = (int) learners.size() - 1; i >= 0; i--) {
+    delete learners[i].sa;
+    delete learners[i].fa;
+  }
+  return 0;
+}
@@ -5,8 +5,12 @@
 #include <thread>
 #include "SarsaAgent.h"
 #include "CMAC.h"
+#include "SharedCMAC.h"
+#include "offense_features.h"
 #include <unistd.h>
 
+using namespace offense;
+
 // Before running this program, first Start HFO server:
 // $./bin/HFO --offense-agents numAgents
 
@@ -25,67 +29,20 @@ void printUsage() {
   std::cout<<"  --suffix <int>           Suffix for weights files"<<std::endl;
   std::cout<<"                           Default: 0"<<std::endl;
   std::cout<<"  --noOpponent             Sets opponent present flag to false"<<std::endl;
+  std::cout<<"  --sharedWeights <name>   Learn into the shared-memory weight table"<<std::endl;
+  std::cout<<"                           <name> (e.g. /hfo_sarsa) instead of"<<std::endl;
+  std::cout<<"                           per-agent weights files"<<std::endl;
   std::cout<<"  --help                   Displays this help and exit"<<std::endl;
 }
 
-// Returns the reward for SARSA based on current state
-double getReward(int status) {
-  double reward;
-  if (status==hfo::GOAL) reward = 1;
-  else if (status==hfo::CAPTURED_BY_DEFENSE) reward = -1;
-  else if (status==hfo::OUT_OF_BOUNDS) reward = -1;
-  else reward = 0;
-  return reward;
-}
-
-// Fill state with only the required features from state_vec
-void purgeFeatures(double *state, const std::vector<float>& state_vec,
-                   int numTMates, bool oppPres) {
-
-  int stateIndex = 0;
-
-  // If no opponents ignore features Distance to Opponent
-  // and Distance from Teammate i to Opponent are absent
-  int tmpIndex = 9 + 3 * numTMates;
-
-  for(int i = 0; i < state_vec.size(); i++) {
-
-    // Ignore first six features and teammate proximity to opponent(when opponent is absent)and opponent features
-    if(i < 6||(!oppPres && ((i>9+numTMates && i<=9+2*numTMates)||i==9))||i>9+6*numTMates) continue;
-
-    // Ignore Angle and Uniform Number of Teammates
-    int temp =  i-tmpIndex;
-    if(temp > 0 && (temp % 3 == 2 || temp % 3 == 0)) continue;
-    if (i > 9+6*numTMates) continue;
-    state[stateIndex] = state_vec[i];
-    stateIndex++;
-  }
-  //std::cout<<stateIndex<<"yo";
-}
-
-// Convert int to hfo::Action
-hfo::action_t toAction(int action, const std::vector<float>& state_vec) {
-  hfo::action_t a;
-  switch(action) {
-    case 0: a = hfo::SHOOT;
-            break;
-    case 1: a = hfo::DRIBBLE;
-            break;
-    default:int size = state_vec.size();
-            a = hfo::PASS;/*,
-                 state_vec[(size - 1) - (action - 2) * 3],
-                 0.0};*/
-  }
-  return a;
-}
-
 void offenseAgent(int port, int numTMates, int numEpi, double learnR,
-                  int suffix, bool oppPres, double eps) {
+                  int suffix, bool oppPres, double eps,
+                  std::string sharedWeights) {
 
   // Number of features
-  int numF = oppPres ? (4 + 4 * numTMates) : (3 + 3 * numTMates);
+  int numF = numFeatures(numTMates, oppPres);
   // Number of actions
-  int numA = 2 + numTMates;
+  int numA = numActions(numTMates);
 
   double discFac = 1;
 
@@ -108,7 +65,15 @@ void offenseAgent(int port, int numTMates, int numEpi, double learnR,
                   "_" + std::to_string(suffix);
   wtFile = &s[0u];
   double lambda = 0;
-  CMAC *fa = new CMAC(numF, numA, range, min, res);
+  CMAC *fa;
+  if (sharedWeights.empty()) {
+    fa = new CMAC(numF, numA, range, min, res);
+  } else {
+    // Agents learn into one table; no weights files are read or written
+    fa = new SharedCMAC(numF, numA, range, min, res, sharedWeights.c_str());
+    s.clear();
+    wtFile = &s[0u];
+  }
   SarsaAgent *sa = new SarsaAgent(numF, numA, learnR, eps, lambda, fa, wtFile, wtFile);
 
   hfo::HFOEnvironment hfo;
@@ -118,6 +83,7 @@ void offenseAgent(int port, int numTMates, int numEpi, double learnR,
   int action = -1;
   double reward;
   hfo.connectToServer(hfo::HIGH_LEVEL_FEATURE_SET,"../../bin/teams/base/config/formations-dt",6000,"localhost","base_left",false,"");
+  hfo.addReward(hfo::GOAL_REWARD);
   for (int episode=0; episode < numEpi; episode++) {
     int count = 0;
     status = hfo::IN_GAME;
@@ -127,7 +93,7 @@ void offenseAgent(int port, int numTMates, int numEpi, double learnR,
       // If has ball
       if(state_vec[5] == 1) {
         if(action != -1) {
-          reward = getReward(status);
+          reward = hfo.getReward();
           sa->update(state, action, reward, discFac);
         }
 
@@ -153,7 +119,7 @@ void offenseAgent(int port, int numTMates, int numEpi, double learnR,
     }
     // End of episode
     if(action != -1) {
-      reward = getReward(status);
+      reward = hfo.getReward();
       sa->update(state, action, reward, discFac);
       sa->endEpisode();
     }
@@ -172,6 +138,7 @@ int main(int argc, char **argv) {
   int suffix = 0;
   bool opponentPresent = true;
   double eps = 0.01;
+  std::string sharedWeights;
   for(int i = 1; i < argc; i++) {
     std::string param = std::string(argv[i]);
     if(param == "--numAgents") {
@@ -190,6 +157,8 @@ int main(int argc, char **argv) {
       suffix = atoi(argv[++i]);
     }else if(param == "--noOpponent") {
       opponentPresent = false;
+    }else if(param == "--sharedWeights") {
+      sharedWeights = argv[++i];
     }else if(param=="--eps"){
         eps=atoi(argv[++i]);
     }else {
@@ -204,7 +173,8 @@ int main(int argc, char **argv) {
   for (int agent = 0; agent < numAgents; agent++) {
     agentThreads[agent] = std::thread(offenseAgent, basePort + agent,
                                       numTeammates, numEpisodes, learnR,
-                                      suffix, opponentPresent, eps);
+                                      suffix, opponentPresent, eps,
+                                      sharedWeights);
     usleep(500000L);
   }
   for (int agent = 0; agent < numAgents; agent++) {
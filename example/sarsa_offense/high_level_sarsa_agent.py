@@ -8,32 +8,6 @@ import sys, os
 sys.path.append(os.path.join(os.path.dirname(__file__), '..', 'sarsa_libraries','python_wrapper'))
 from py_wrapper import *
 
-def getReward(s):
-  reward=0
-  #--------------------------- 
-  if s==GOAL:
-    reward=1
-  #--------------------------- 
-  elif s==CAPTURED_BY_DEFENSE:
-    reward=-1
-  #--------------------------- 
-  elif s==OUT_OF_BOUNDS:
-    reward=-1
-  #--------------------------- 
-  #Cause Unknown Do Nothing
-  elif s==OUT_OF_TIME:
-    reward=0
-  #--------------------------- 
-  elif s==IN_GAME:
-    reward=0
-  #--------------------------- 
-  elif s==SERVER_DOWN:  
-    reward=0
-  #--------------------------- 
-  else:
-    print("Error: Unknown GameState", s)
-  return reward
-
 def purge_features(state):
   st=np.empty(NF,dtype=np.float64)
   stateIndex=0
@@ -67,6 +41,7 @@ if __name__ == '__main__':
   hfo = HFOEnvironment()
   #now connect to the server
   hfo.connectToServer(HIGH_LEVEL_FEATURE_SET,'bin/teams/base/config/formations-dt',args.port,'localhost','base_left',False)
+  hfo.addReward(GOAL_REWARD)
   global NF,NA,NOT,NOO
   NOO=args.numOpponents
   if args.numOpponents >0: 
@@ -106,7 +81,7 @@ if __name__ == '__main__':
       if int(state[5])==1:
         if action != -1:
           #print(st)
-          reward=getReward(status)
+          reward=hfo.getReward()
           #fb.SA.update(state,action,reward,discFac)
           SA.update(st,action,reward,discFac)
         st=purge_features(state)
@@ -129,13 +104,14 @@ if __name__ == '__main__':
     ############# EPISODE ENDS ###################################################################################
     # Check the outcome of the episode
     if action != -1:
-      reward=getReward(status)
+      reward=hfo.getReward()
       SA.update(st, action, reward, discFac)
       SA.endEpisode()
     ############################################################################################################
     # Quit if the server goes down
     if status == SERVER_DOWN:
       hfo.act(QUIT)
+      SA.flushWeights()
       break
 
    
@@ -0,0 +1,64 @@
+#ifndef OFFENSE_FEATURES_H
+#define OFFENSE_FEATURES_H
+
+#include <vector>
+#include <HFO.hpp>
+
+// Features and actions of the offense SARSA agents, shared by
+// high_level_sarsa_agent and high_level_sarsa_multi_agent
+
+namespace offense {
+
+// Number of features kept by purgeFeatures
+inline int numFeatures(int numTMates, bool oppPres) {
+  return oppPres ? (4 + 4 * numTMates) : (3 + 3 * numTMates);
+}
+
+// Number of actions: SHOOT, DRIBBLE and a PASS to each teammate
+inline int numActions(int numTMates) {
+  return 2 + numTMates;
+}
+
+// Fill state with only the required features from state_vec
+inline void purgeFeatures(double *state, const std::vector<float>& state_vec,
+                          int numTMates, bool oppPres) {
+
+  int stateIndex = 0;
+
+  // If no opponents ignore features Distance to Opponent
+  // and Distance from Teammate i to Opponent are absent
+  int tmpIndex = 9 + 3 * numTMates;
+
+  for(int i = 0; i < state_vec.size(); i++) {
+
+    // Ignore first six features and teammate proximity to opponent(when opponent is absent)and opponent features
+    if(i < 6||(!oppPres && ((i>9+numTMates && i<=9+2*numTMates)||i==9))||i>9+6*numTMates) continue;
+
+    // Ignore Angle and Uniform Number of Teammates
+    int temp =  i-tmpIndex;
+    if(temp > 0 && (temp % 3 == 2 || temp % 3 == 0)) continue;
+    if (i > 9+6*numTMates) continue;
+    state[stateIndex] = state_vec[i];
+    stateIndex++;
+  }
+}
+
+// Convert int to hfo::Action
+inline hfo::action_t toAction(int action, const std::vector<float>& state_vec) {
+  hfo::action_t a;
+  switch(action) {
+    case 0: a = hfo::SHOOT;
+            break;
+    case 1: a = hfo::DRIBBLE;
+            break;
+    default:int size = state_vec.size();
+            a = hfo::PASS;/*,
+                 state_vec[(size - 1) - (action - 2) * 3],
+                 0.0};*/
+  }
+  return a;
+}
+
+} // namespace offense
+
+#endif
@@ -62,6 +62,8 @@ void EnvConnect(HFOEnvironment* env, int server_port, string team_name,
     }
     *status_ptr = env->step();
     *need_to_step = false;
+    // Wake the player thread waiting in stepThread
+    cv->notify_all();
   }
 }
 
@@ -70,13 +72,13 @@ void act(int tid, action_t action, float arg1, float arg2) {
   envs_[tid].act(action, arg1, arg2);
 }
 
+// Has the environment thread of tid step, and sleeps until it is done
 void stepThread(int tid) {
-  mutexs_[tid].lock();
+  std::unique_lock<std::mutex> lck(mutexs_[tid]);
   need_to_step_[tid] = true;
-  cvs_[tid].notify_one();
-  mutexs_[tid].unlock();
+  cvs_[tid].notify_all();
   while (need_to_step_[tid]) {
-    std::this_thread::yield();
+    cvs_[tid].wait(lck);
   }
 }
 
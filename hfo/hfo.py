@@ -59,19 +59,39 @@ Possible game statuses:
   [OUT_OF_BOUNDS] Ball has gone out of bounds
   [OUT_OF_TIME] Trial has ended due to time limit
   [SERVER_DOWN] Server is not alive
+  [STEP_TIMEOUT] No cycle arrived within the step timeout
 """
-NUM_GAME_STATUS_STATES = 6
-IN_GAME, GOAL, CAPTURED_BY_DEFENSE, OUT_OF_BOUNDS, OUT_OF_TIME, SERVER_DOWN = list(range(NUM_GAME_STATUS_STATES))
+NUM_GAME_STATUS_STATES = 7
+IN_GAME, GOAL, CAPTURED_BY_DEFENSE, OUT_OF_BOUNDS, OUT_OF_TIME, SERVER_DOWN, \
+  STEP_TIMEOUT = list(range(NUM_GAME_STATUS_STATES))
 STATUS_STRINGS = {IN_GAME: "InGame",
                   GOAL: "Goal",
                   CAPTURED_BY_DEFENSE: "CapturedByDefense",
                   OUT_OF_BOUNDS: "OutOfBounds",
                   OUT_OF_TIME: "OutOfTime",
-                  SERVER_DOWN: "ServerDown"}
+                  SERVER_DOWN: "ServerDown",
+                  STEP_TIMEOUT: "StepTimeout"}
+
+"""Built-in rewards, see reward_function.h
+  [GOAL_REWARD] +1/-1 when the episode ends for/against the agent's team
+  [BALL_PROGRESS_REWARD] Meters the ball moved toward the goal attacked by the offense (negated on defense)
+  [POSSESSION_REWARD] +1/-1 when the agent's team/the opponents gain the ball
+  [PASS_REWARD] +1 when a kick of the agent reaches a teammate
+"""
+GOAL_REWARD, BALL_PROGRESS_REWARD, POSSESSION_REWARD, PASS_REWARD = list(range(4))
 
 """Possible sides."""
 RIGHT, NEUTRAL, LEFT = list(range(-1,2))
 
+"""Fields of the action-chain planner counters, see hfo::PlannerStats."""
+PLANNER_STATS_FIELDS = ['calls', 'generated', 'evaluated', 'best_count',
+                        'best_depth_sum', 'best_depth_max', 'generate_usec',
+                        'evaluate_usec', 'total_usec']
+
+"""Fields of the step timings, see hfo::TimingStats."""
+TIMING_STATS_FIELDS = ['count', 'total_usec', 'min_usec', 'max_usec',
+                       'p50_usec', 'p90_usec', 'p99_usec', 'p999_usec']
+
 class Player(Structure): pass
 Player._fields_ = [
     ('side', c_int),
@@ -99,6 +119,23 @@ hfo_lib.playerOnBall.argtypes = [c_void_p]
 hfo_lib.playerOnBall.restype = Player
 hfo_lib.step.argtypes = [c_void_p]
 hfo_lib.step.restype = c_int
+hfo_lib.setStepTimeout.argtypes = [c_void_p, c_int]
+hfo_lib.setStepTimeout.restype = None
+hfo_lib.stepRepeat.argtypes = [c_void_p, c_int, POINTER(c_int),
+                               POINTER(c_float), c_void_p]
+hfo_lib.stepRepeat.restype = c_int
+hfo_lib.addReward.argtypes = [c_void_p, c_int, c_float]
+hfo_lib.addReward.restype = None
+hfo_lib.getReward.argtypes = [c_void_p]
+hfo_lib.getReward.restype = c_float
+hfo_lib.saveState.argtypes = [c_void_p]
+hfo_lib.saveState.restype = c_int
+hfo_lib.restoreState.argtypes = [c_void_p, c_int]
+hfo_lib.restoreState.restype = c_bool
+hfo_lib.dropState.argtypes = [c_void_p, c_int]
+hfo_lib.dropState.restype = c_bool
+hfo_lib.getBehaviorAllocations.argtypes = [c_void_p]
+hfo_lib.getBehaviorAllocations.restype = c_ulong
 hfo_lib.numParams.argtypes = [c_int]
 hfo_lib.numParams.restype = c_int
 hfo_lib.getUnum.argtypes = [c_void_p]
@@ -107,6 +144,20 @@ hfo_lib.getNumTeammates.argtypes = [c_void_p]
 hfo_lib.getNumTeammates.restype = c_int
 hfo_lib.getNumOpponents.argtypes = [c_void_p]
 hfo_lib.getNumOpponents.restype = c_int
+hfo_lib.getPlannerStatsSize.argtypes = [c_void_p]
+hfo_lib.getPlannerStatsSize.restype = c_int
+hfo_lib.getPlannerStatsName.argtypes = [c_void_p, c_int]
+hfo_lib.getPlannerStatsName.restype = c_char_p
+hfo_lib.getPlannerStatsValues.argtypes = [c_void_p, c_int, c_void_p]
+hfo_lib.getPlannerStatsValues.restype = None
+hfo_lib.getTimingStatsSize.argtypes = [c_void_p]
+hfo_lib.getTimingStatsSize.restype = c_int
+hfo_lib.getTimingStatsName.argtypes = [c_void_p, c_int]
+hfo_lib.getTimingStatsName.restype = c_char_p
+hfo_lib.getTimingStatsValues.argtypes = [c_void_p, c_int, c_void_p]
+hfo_lib.getTimingStatsValues.restype = None
+hfo_lib.resetTimingStats.argtypes = [c_void_p]
+hfo_lib.resetTimingStats.restype = None
 
 class HFOEnvironment(object):
   def __init__(self):
@@ -178,6 +229,55 @@ class HFOEnvironment(object):
     """ Advances the state of the environment """
     return hfo_lib.step(self.obj)
 
+  def setStepTimeout(self, msec):
+    """ Makes step return STEP_TIMEOUT if the next cycle does not arrive
+    within msec milliseconds. The server may still be alive: the next step
+    keeps waiting for that cycle without sending another action, so the
+    action given to act before it is ignored. 0 waits as long as the
+    server is alive. """
+    hfo_lib.setStepTimeout(self.obj, msec)
+
+  def stepRepeat(self, repeat, state_data=None):
+    """ Repeats the current action for up to repeat cycles, stopping early
+    if the episode ends. Features are only extracted after the last cycle.
+    Returns (status, cycles taken, reward, state features) """
+    if state_data is None:
+      state_data = np.zeros(self.getStateSize(), dtype=np.float32)
+    cycles = c_int(0)
+    reward = c_float(0)
+    status = hfo_lib.stepRepeat(self.obj, repeat, byref(cycles), byref(reward),
+                                as_ctypes(state_data))
+    return status, cycles.value, reward.value, state_data
+
+  def addReward(self, reward_type, weight=1.0):
+    """ Adds weight times a built-in reward to the reward of each step """
+    hfo_lib.addReward(self.obj, reward_type, weight)
+
+  def getReward(self):
+    """ Returns the reward accumulated over the cycles of the last step """
+    return hfo_lib.getReward(self.obj)
+
+  def saveState(self):
+    """ Asks the trainer to snapshot the game state, taking NOOP steps
+    until it answers. Returns the snapshot id, or -1 on failure. The
+    trainer keeps every snapshot until it is dropped with dropState """
+    return hfo_lib.saveState(self.obj)
+
+  def restoreState(self, snapshot_id):
+    """ Asks the trainer to restore a snapshot in a single cycle, taking
+    NOOP steps until it answers. Returns False on failure """
+    return hfo_lib.restoreState(self.obj, snapshot_id)
+
+  def dropState(self, snapshot_id):
+    """ Asks the trainer to free a snapshot, taking NOOP steps until it
+    answers; the id is not reused. Returns False on failure """
+    return hfo_lib.dropState(self.obj, snapshot_id)
+
+  def getBehaviorAllocations(self):
+    """ Returns the number of heap blocks taken by the pools of per-cycle
+    behavior objects, which stops growing in the steady state """
+    return hfo_lib.getBehaviorAllocations(self.obj)
+
   def actionToString(self, action):
     """ Returns a string representation of an action """
     return ACTION_STRINGS[action]
@@ -197,3 +297,32 @@ class HFOEnvironment(object):
   def getNumOpponents(self):
     """ Returns the number of opponents of the agent """
     return hfo_lib.getNumOpponents(self.obj)
+
+  def getPlannerStats(self):
+    """ Returns the action-chain planner counters of the current episode
+    as a dict of generator name to a dict of PLANNER_STATS_FIELDS """
+    stats = {}
+    values = np.zeros(len(PLANNER_STATS_FIELDS), dtype=np.float64)
+    for i in range(hfo_lib.getPlannerStatsSize(self.obj)):
+      name = hfo_lib.getPlannerStatsName(self.obj, i).decode('utf-8')
+      hfo_lib.getPlannerStatsValues(self.obj, i,
+                                    values.ctypes.data_as(POINTER(c_double)))
+      stats[name] = dict(zip(PLANNER_STATS_FIELDS, values.tolist()))
+    return stats
+
+  def getTimingStats(self):
+    """ Returns the latencies of the phases of connectToServer and step as
+    a dict of phase name to a dict of TIMING_STATS_FIELDS. "receive" waits
+    for the server; "execute" and "pre_action" run the agent. """
+    stats = {}
+    values = np.zeros(len(TIMING_STATS_FIELDS), dtype=np.float64)
+    for i in range(hfo_lib.getTimingStatsSize(self.obj)):
+      name = hfo_lib.getTimingStatsName(self.obj, i).decode('utf-8')
+      hfo_lib.getTimingStatsValues(self.obj, i,
+                                   values.ctypes.data_as(POINTER(c_double)))
+      stats[name] = dict(zip(TIMING_STATS_FIELDS, values.tolist()))
+    return stats
+
+  def resetTimingStats(self):
+    """ Clears the step timings """
+    hfo_lib.resetTimingStats(self.obj)
@@ -38,11 +38,92 @@ extern "C" {
   const char* hear(hfo::HFOEnvironment *hfo) { return hfo->hear().c_str(); }
   hfo::Player playerOnBall(hfo::HFOEnvironment *hfo) { return hfo->playerOnBall(); }
   hfo::status_t step(hfo::HFOEnvironment *hfo) { return hfo->step(); }
+  void setStepTimeout(hfo::HFOEnvironment *hfo, int msec) { hfo->setStepTimeout(msec); }
+  // Repeats the current action for up to repeat cycles. Stores the cycles
+  // taken in cycles, the reward of the step in reward and, unless
+  // state_data is NULL, the final state.
+  hfo::status_t stepRepeat(hfo::HFOEnvironment *hfo, int repeat, int *cycles,
+                           float *reward, float *state_data) {
+    hfo::status_t status = hfo->step(repeat, cycles);
+    *reward = hfo->getReward();
+    if (state_data != NULL) {
+      getState(hfo, state_data);
+    }
+    return status;
+  }
+  void addReward(hfo::HFOEnvironment *hfo, hfo::reward_t reward, float weight) {
+    hfo->addReward(reward, weight);
+  }
+  float getReward(hfo::HFOEnvironment *hfo) { return hfo->getReward(); }
+  int saveState(hfo::HFOEnvironment *hfo) { return hfo->saveState(); }
+  bool restoreState(hfo::HFOEnvironment *hfo, int id) { return hfo->restoreState(id); }
+  bool dropState(hfo::HFOEnvironment *hfo, int id) { return hfo->dropState(id); }
+  unsigned long getBehaviorAllocations(hfo::HFOEnvironment *hfo) {
+    return hfo->getBehaviorAllocations();
+  }
 
   int numParams(const hfo::action_t action) { return NumParams(action); }
   int getUnum(hfo::HFOEnvironment *hfo) {return hfo->getUnum();}
   int getNumTeammates(hfo::HFOEnvironment *hfo) {return hfo->getNumTeammates();}
   int getNumOpponents(hfo::HFOEnvironment *hfo) {return hfo->getNumOpponents();}
+
+  // Refreshes the planner counters and returns the number of entries
+  int getPlannerStatsSize(hfo::HFOEnvironment *hfo) { return hfo->getPlannerStats().size(); }
+  // NULL if index is out of range
+  const char* getPlannerStatsName(hfo::HFOEnvironment *hfo, int index) {
+    const std::vector<hfo::PlannerStats>& stats = hfo->getPlannerStats();
+    if (index < 0 || index >= (int) stats.size()) {
+      return NULL;
+    }
+    return stats[index].name.c_str();
+  }
+  // Writes the 9 numeric fields of hfo::PlannerStats in declaration order;
+  // values is left untouched if index is out of range
+  void getPlannerStatsValues(hfo::HFOEnvironment *hfo, int index, double *values) {
+    const std::vector<hfo::PlannerStats>& stats = hfo->getPlannerStats();
+    if (index < 0 || index >= (int) stats.size()) {
+      return;
+    }
+    const hfo::PlannerStats& s = stats[index];
+    values[0] = s.calls;
+    values[1] = s.generated;
+    values[2] = s.evaluated;
+    values[3] = s.best_count;
+    values[4] = s.best_depth_sum;
+    values[5] = s.best_depth_max;
+    values[6] = s.generate_usec;
+    values[7] = s.evaluate_usec;
+    values[8] = s.total_usec;
+  }
+
+  // Refreshes the step timings and returns the number of phases
+  int getTimingStatsSize(hfo::HFOEnvironment *hfo) { return hfo->getTimingStats().size(); }
+  // NULL if index is out of range
+  const char* getTimingStatsName(hfo::HFOEnvironment *hfo, int index) {
+    const std::vector<hfo::TimingStats>& stats = hfo->getTimingStats();
+    if (index < 0 || index >= (int) stats.size()) {
+      return NULL;
+    }
+    return stats[index].name.c_str();
+  }
+  // Writes the 8 numeric fields of hfo::TimingStats in declaration order;
+  // values is left untouched if index is out of range
+  void getTimingStatsValues(hfo::HFOEnvironment *hfo, int index, double *values) {
+    const std::vector<hfo::TimingStats>& stats = hfo->getTimingStats();
+    if (index < 0 || index >= (int) stats.size()) {
+      return;
+    }
+    const hfo::TimingStats& s = stats[index];
+    values[0] = s.count;
+    values[1] = s.total_usec;
+    values[2] = s.min_usec;
+    values[3] = s.max_usec;
+    values[4] = s.p50_usec;
+    values[5] = s.p90_usec;
+    values[6] = s.p99_usec;
+    values[7] = s.p999_usec;
+  }
+  void resetTimingStats(hfo::HFOEnvironment *hfo) { hfo->resetTimingStats(); }
 }
 
 #endif
@@ -11,6 +11,8 @@
 #include <iostream>
 #include <stdarg.h>
 #include <agent.h>
+#include <pooled.h>
+#include <step_timer.h>
 #include <rcsc/common/basic_client.h>
 #include <rcsc/player/player_config.h>
 #include <rcsc/player/world_model.h>
@@ -18,15 +20,21 @@
 using namespace hfo;
 
 #define MAX_STEPS 100
+// Cycles to wait for the trainer to answer a snapshot request
+#define MAX_STATE_REPLY_CYCLES 50
 
 HFOEnvironment::HFOEnvironment() {
   client = new rcsc::BasicClient();
   agent = new Agent();
+  timer = new StepTimer();
+  step_timeout_msec = 0;
+  cycle_pending = false;
 }
 
 HFOEnvironment::~HFOEnvironment() {
   delete client;
   delete agent;
+  delete timer;
 }
 
 void HFOEnvironment::connectToServer(feature_set_t feature_set,
@@ -36,6 +44,7 @@ void HFOEnvironment::connectToServer(feature_set_t feature_set,
                                      std::string team_name,
                                      bool play_goalie,
                                      std::string record_dir) {
+  double start = StepTimer::now();
   agent->setFeatureSet(feature_set);
   rcsc::PlayerConfig& config = agent->mutable_config();
   config.setConfigDir(config_dir);
@@ -76,6 +85,7 @@ void HFOEnvironment::connectToServer(feature_set_t feature_set,
   agent->ProcessTeammateMessages();
   agent->UpdateFeatures();
   current_cycle = agent->currentTime().cycle();
+  timer->add(StepTimer::CONNECT, StepTimer::now() - start);
 }
 
 const std::vector<float>& HFOEnvironment::getState() {
@@ -127,29 +137,168 @@ Player HFOEnvironment::playerOnBall() {
   return agent->getPlayerOnBall();
 }
 
-status_t HFOEnvironment::step() {
-  // Execute the action
-  agent->executeAction();
+const std::vector<PlannerStats>& HFOEnvironment::getPlannerStats() {
+  agent->getPlannerStats(&planner_stats);
+  return planner_stats;
+}
+
+void HFOEnvironment::addReward(reward_t reward, float weight) {
+  agent->addRewardFunction(Agent::getRewardFunction(reward), weight);
+}
+
+void HFOEnvironment::addRewardFunction(RewardFunction* reward, float weight) {
+  agent->addRewardFunction(reward, weight);
+}
+
+float HFOEnvironment::getReward() {
+  return agent->getReward();
+}
+
+void HFOEnvironment::setStepTimeout(int msec) {
+  step_timeout_msec = msec;
+}
+
+const std::vector<TimingStats>& HFOEnvironment::getTimingStats() {
+  timer->getStats(&timing_stats);
+  return timing_stats;
+}
 
-  // Advance the environment by one step
+void HFOEnvironment::resetTimingStats() {
+  timer->reset();
+}
+
+unsigned long HFOEnvironment::getBehaviorAllocations() {
+  return PoolStats::heap_allocations();
+}
+
+status_t HFOEnvironment::advance(bool update_features) {
+  // Execute the action, unless it was already sent for the cycle that
+  // timed out
+  double start = StepTimer::now();
+  double end = start;
+  if (!cycle_pending) {
+    agent->executeAction();
+    end = StepTimer::now();
+    timer->add(StepTimer::EXECUTE, end - start);
+  }
+
+  // Advance the environment by one step. runStep() sleeps in select() on
+  // the server socket until a message arrives or its interval passes.
+  double receive_usec = 0;
+  double trainer_usec = 0;
+  const double wait_start = end;
+  bool waiting;
   do {
+    start = end;
     ready_for_action = client->runStep(agent);
+    end = StepTimer::now();
+    receive_usec += end - start;
     if (!client->isServerAlive() || agent->getGameStatus() == SERVER_DOWN) {
       return SERVER_DOWN;
     }
+    start = end;
     agent->ProcessTrainerMessages();
-  } while (agent->statusUpdateTime() <= current_cycle || !ready_for_action);
+    end = StepTimer::now();
+    trainer_usec += end - start;
+    waiting = agent->statusUpdateTime() <= current_cycle || !ready_for_action;
+    // Only give up if the cycle is still incomplete
+    if (waiting && step_timeout_msec > 0
+        && end - wait_start > step_timeout_msec * 1000.0) {
+      std::cerr << "[Step] No server cycle within " << step_timeout_msec
+                << " ms" << std::endl;
+      timer->add(StepTimer::RECEIVE, receive_usec);
+      timer->add(StepTimer::TRAINER, trainer_usec);
+      cycle_pending = true;
+      return STEP_TIMEOUT;
+    }
+  } while (waiting);
+  cycle_pending = false;
+  timer->add(StepTimer::RECEIVE, receive_usec);
+  timer->add(StepTimer::TRAINER, trainer_usec);
 
   // Update the state features
+  start = end;
+  agent->setUpdateFeatures(update_features);
   agent->preAction();
+  agent->setUpdateFeatures(true);
+  timer->add(StepTimer::PRE_ACTION, StepTimer::now() - start);
   current_cycle = agent->currentTime().cycle();
-  status_t status = agent->getGameStatus();
-  // If the episode is over, take three NOOPs to refresh state features
-  if (status != IN_GAME && status != SERVER_DOWN) {
-    for (int i = 0; i < 3; ++i) {
-      act(NOOP);
-      step();
+  return agent->getGameStatus();
+}
+
+void HFOEnvironment::refreshState() {
+  float reward = agent->getReward();
+  for (int i = 0; i < 3; ++i) {
+    act(NOOP);
+    step();
+  }
+  agent->resetReward(reward);
+}
+
+int HFOEnvironment::waitStateReply() {
+  for (int i = 0; i < MAX_STATE_REPLY_CYCLES && !agent->stateReplied(); ++i) {
+    act(NOOP);
+    const status_t status = step();
+    if (status == SERVER_DOWN || status == STEP_TIMEOUT) {
+      return -1;
     }
   }
+  if (!agent->stateReplied()) {
+    std::cerr << "[StateSnapshot] No answer from the trainer within "
+              << MAX_STATE_REPLY_CYCLES << " cycles" << std::endl;
+    return -1;
+  }
+  return agent->getStateReplyId();
+}
+
+int HFOEnvironment::saveState() {
+  agent->requestSaveState();
+  return waitStateReply();
+}
+
+bool HFOEnvironment::restoreState(int id) {
+  agent->requestRestoreState(id);
+  if (waitStateReply() < 0) {
+    return false;
+  }
+  act(NOOP);
+  const status_t status = step();
+  return status != SERVER_DOWN && status != STEP_TIMEOUT;
+}
+
+bool HFOEnvironment::dropState(int id) {
+  agent->requestDropState(id);
+  return waitStateReply() >= 0;
+}
+
+status_t HFOEnvironment::step() {
+  double start = StepTimer::now();
+  agent->resetReward();
+  status_t status = advance(true);
+  // If the episode is over, take three NOOPs to refresh state features
+  if (status != IN_GAME && status != SERVER_DOWN && status != STEP_TIMEOUT) {
+    refreshState();
+  }
+  timer->add(StepTimer::STEP, StepTimer::now() - start);
+  return status;
+}
+
+status_t HFOEnvironment::step(int repeat, int* cycles) {
+  double start = StepTimer::now();
+  status_t status = IN_GAME;
+  int taken = 0;
+  agent->resetReward();
+  do {
+    ++taken;
+    status = advance(taken >= repeat);
+  } while (taken < repeat && status == IN_GAME);
+  if (cycles != NULL) {
+    *cycles = taken;
+  }
+  // The NOOPs also extract the features skipped when ending early
+  if (status != IN_GAME && status != SERVER_DOWN && status != STEP_TIMEOUT) {
+    refreshState();
+  }
+  timer->add(StepTimer::STEP, StepTimer::now() - start);
   return status;
 }
@@ -6,6 +6,8 @@
 #include "common.hpp"
 
 class Agent;
+class RewardFunction;
+class StepTimer;
 namespace rcsc { class BasicClient; }
 
 namespace hfo {
@@ -58,15 +60,91 @@ class HFOEnvironment {
   // Get the current player holding the ball
   virtual Player playerOnBall();
 
+  // Get the action-chain planner counters of the current episode, one
+  // entry per behavior generator followed by the "total" entry. The
+  // counters are reset when the next episode begins.
+  virtual const std::vector<PlannerStats>& getPlannerStats();
+
+  // Limits how long step() waits for the sense and trainer messages of
+  // the next cycle. If they do not arrive within msec, step() returns
+  // STEP_TIMEOUT; the server may still be alive, and the next step()
+  // keeps waiting for that cycle without sending another action, so the
+  // action given to act() before it is ignored. 0 (the default) waits as
+  // long as the server is alive.
+  virtual void setStepTimeout(int msec);
+
+  // Get the latency histograms of the phases of connectToServer() and
+  // step(), to tell whether the server or the agent bounds the step rate:
+  // "receive" waits for the server, "execute" and "pre_action" run the
+  // agent.
+  virtual const std::vector<TimingStats>& getTimingStats();
+  virtual void resetTimingStats();
+
+  // Adds weight times a built-in reward to the reward of each step. The
+  // reward is 0 until a reward is added.
+  virtual void addReward(reward_t reward, float weight=1);
+
+  // Adds weight times a custom reward; the environment takes ownership
+  virtual void addRewardFunction(RewardFunction* reward, float weight=1);
+
+  // Returns the reward accumulated over the cycles of the last step
+  virtual float getReward();
+
+  // Returns the number of heap blocks taken so far by the pools of the
+  // per-cycle view, neck, intention and say message objects on this
+  // thread. It stops growing once the agent reaches its steady state.
+  virtual unsigned long getBehaviorAllocations();
+
+  // Asks the trainer to snapshot the game state: the position, velocity
+  // and body direction of the ball and of every player. Takes NOOP steps
+  // until the trainer answers, and returns the id of the snapshot, or -1
+  // if the trainer did not answer. The trainer keeps every snapshot until
+  // it is dropped with dropState().
+  virtual int saveState();
+
+  // Asks the trainer to restore snapshot id, which moves the ball and all
+  // players in a single cycle and gives every player full stamina. Takes
+  // NOOP steps until the trainer answers, then one more so that the state
+  // features describe the restored game. Any agent may restore a snapshot
+  // saved by another. Returns false if id is unknown or the trainer did
+  // not answer. The episode clock of the server is not rewound.
+  virtual bool restoreState(int id);
+
+  // Asks the trainer to free snapshot id, taking NOOP steps until it
+  // answers; its id is not reused. Returns false if id is unknown or the
+  // trainer did not answer.
+  virtual bool dropState(int id);
+
   // Indicates the agent is done and the environment should
   // progress. Returns the game status after the step
   virtual status_t step();
 
+  // Repeats the current action for up to repeat cycles, stopping early if
+  // the episode ends. The state features are only extracted after the
+  // last cycle. Returns the game status after the last cycle and stores
+  // the number of cycles taken in cycles, if given.
+  virtual status_t step(int repeat, int* cycles=NULL);
+
  private:
+  // Executes the current action and waits for the next cycle. The state
+  // features are only updated if update_features is set.
+  status_t advance(bool update_features);
+  // Takes three NOOPs after an episode ends to refresh the state
+  // features. Their rewards belong to the next episode and are dropped.
+  void refreshState();
+  // Takes NOOP steps until the trainer answers the pending snapshot
+  // request. Returns the snapshot id of the answer, -1 on failure.
+  int waitStateReply();
+
   rcsc::BasicClient* client;
   Agent* agent;
   long current_cycle;
   bool ready_for_action;
+  std::vector<PlannerStats> planner_stats;
+  StepTimer* timer;
+  int step_timeout_msec;
+  bool cycle_pending; // The last advance() timed out before its cycle came
+  std::vector<TimingStats> timing_stats;
 };
 
 } // namespace hfo
@@ -9,6 +9,8 @@
 #include "field_analyzer.h"
 
 #include "action_chain_holder.h"
+#include "action_chain_profiler.h"
+#include "ball_travel_table.h"
 #include "sample_field_evaluator.h"
 
 #include "soccer_role.h"
@@ -33,6 +35,7 @@
 #include "intention_receive.h"
 #include "lowlevel_feature_extractor.h"
 #include "highlevel_feature_extractor.h"
+#include "reward_function.h"
 
 #include "actgen_cross.h"
 #include "actgen_direct_pass.h"
@@ -42,6 +45,8 @@
 #include "actgen_simple_dribble.h"
 #include "actgen_shoot.h"
 #include "actgen_action_chain_length_filter.h"
+#include "actgen_profile.h"
+#include "pooled.h"
 
 #include <rcsc/action/basic_actions.h>
 #include <rcsc/action/bhv_emergency.h>
@@ -104,7 +109,13 @@ Agent::Agent()
       lastTeammateMessageTime(-1),
       lastStatusUpdateTime(-1),
       game_status(IN_GAME),
-      requested_action(NOOP)
+      requested_action(NOOP),
+      update_features(true),
+      reward(0),
+      state_request_time(-1),
+      state_request_seq(0),
+      state_replied(false),
+      state_reply_id(-1)
 {
     boost::shared_ptr< AudioMemory > audio_memory( new AudioMemory );
 
@@ -234,6 +245,22 @@ FeatureExtractor* Agent::getFeatureExtractor(feature_set_t feature_set_indx,
   }
 }
 
+RewardFunction* Agent::getRewardFunction(reward_t reward_type) {
+  switch (reward_type) {
+    case GOAL_REWARD:
+      return new GoalReward();
+    case BALL_PROGRESS_REWARD:
+      return new BallProgressReward();
+    case POSSESSION_REWARD:
+      return new PossessionReward();
+    case PASS_REWARD:
+      return new PassReward();
+    default:
+      std::cerr << "ERROR: Unrecognized reward: " << reward_type << std::endl;
+      exit(1);
+  }
+}
+
 /*!
   main decision
   virtual method in super class
@@ -257,12 +284,12 @@ void Agent::actionImpl() {
 
   const WorldModel & wm = this->world();
 
-  this->setViewAction(new View_Tactical());
+  this->setViewAction(new Pooled< View_Tactical >());
 
   if (wm.ball().posValid()) {
-    this->setNeckAction(new Neck_TurnToBallOrScan()); // if not ball().posValid(), requests possibly-invalid queuedNextBallPos()
+    this->setNeckAction(new Pooled< Neck_TurnToBallOrScan >()); // if not ball().posValid(), requests possibly-invalid queuedNextBallPos()
   } else {
-    this->setNeckAction(new Neck_ScanField()); // equivalent to Neck_TurnToBall()
+    this->setNeckAction(new Pooled< Neck_ScanField >()); // equivalent to Neck_TurnToBall()
   }
 
 
@@ -369,14 +396,88 @@ Agent::ProcessTrainerMessages()
             feature_set, num_teammates, num_opponents, playing_offense);
       }
     }
-    if (hfo::ParseGameStatus(message, game_status)) {
+    bool restored;
+    int id, unum, seq;
+    std::string team;
+    const hfo::status_t last_status = game_status;
+    if (hfo::ParseStateReply(message, restored, id, team, unum, seq)) {
+      if (!state_request.empty() && team == world().teamName()
+          && unum == world().self().unum() && seq == state_request_seq) {
+        state_request.clear();
+        state_replied = true;
+        state_reply_id = id;
+      }
+      if (restored && id >= 0) {
+        // Rewards must not credit the jump to the restored state
+        reward_function.reset();
+      }
+    } else if (hfo::ParseGameStatus(message, game_status)) {
       lastStatusUpdateTime = audioSensor().trainerMessageTime().cycle();
+      if (game_status == IN_GAME && last_status != IN_GAME) {
+        // A new episode begins. Counters of the last one are kept until now.
+        ActionChainProfiler::instance().startEpisode();
+        reward_function.reset();
+      }
     }
     hfo::ParsePlayerOnBall(message, player_on_ball);
     lastTrainerMessageTime = audioSensor().trainerMessageTime().cycle();
   }
 }
 
+void
+Agent::getPlannerStats(std::vector<hfo::PlannerStats>* stats) const
+{
+  const ActionChainProfiler & profiler = ActionChainProfiler::i();
+  const std::vector<ActionChainProfiler::Counter>& generators = profiler.generators();
+
+  stats->resize(generators.size() + 1);
+  for (size_t i = 0; i <= generators.size(); ++i) {
+    const ActionChainProfiler::Counter& c =
+        (i < generators.size() ? generators[i] : profiler.total());
+    hfo::PlannerStats& s = (*stats)[i];
+    s.name = c.name_;
+    s.calls = c.calls_;
+    s.generated = c.generated_;
+    s.evaluated = c.evaluated_;
+    s.best_count = c.best_count_;
+    s.best_depth_sum = c.best_depth_sum_;
+    s.best_depth_max = c.best_depth_max_;
+    s.generate_usec = c.generate_usec_;
+    s.evaluate_usec = c.evaluate_usec_;
+    s.total_usec = c.total_usec_;
+  }
+}
+
+void
+Agent::requestSaveState()
+{
+  state_request_seq = (state_request_seq + 1) % 10;
+  state_request = "sv" + std::to_string(state_request_seq);
+  state_request_time = -1;
+  state_replied = false;
+  state_reply_id = -1;
+}
+
+void
+Agent::requestRestoreState(int id)
+{
+  state_request_seq = (state_request_seq + 1) % 10;
+  state_request = "ld" + std::to_string(state_request_seq) + " " + std::to_string(id);
+  state_request_time = -1;
+  state_replied = false;
+  state_reply_id = -1;
+}
+
+void
+Agent::requestDropState(int id)
+{
+  state_request_seq = (state_request_seq + 1) % 10;
+  state_request = "dr" + std::to_string(state_request_seq) + " " + std::to_string(id);
+  state_request_time = -1;
+  state_replied = false;
+  state_reply_id = -1;
+}
+
 void
 Agent::ProcessTeammateMessages()
 {
@@ -403,12 +504,23 @@ Agent::UpdateFeatures()
   }
 }
 
+void
+Agent::UpdateReward()
+{
+  if (!reward_function.empty()) {
+    reward += reward_function.computeReward(this->world(), game_status);
+  }
+}
+
 void
 Agent::handleActionStart()
 {
   ProcessTrainerMessages();
   ProcessTeammateMessages();
-  UpdateFeatures();
+  if (update_features) {
+    UpdateFeatures();
+  }
+  UpdateReward();
 
   // Optionally write to logfile
 #ifdef ELOG
@@ -559,6 +671,13 @@ Agent::handleServerParam()
         M_client->setServerAlive( false );
     }
 
+    if ( ! BallTravelTable::instance().createTables() )
+    {
+        std::cerr << world().teamName() << ' '
+                  << world().self().unum() << ": "
+                  << " BallTravelTable failed. use direct calculation."
+                  << std::endl;
+    }
 
     if ( ServerParam::i().keepawayMode() )
     {
@@ -595,9 +714,20 @@ Agent::handlePlayerType()
 void
 Agent::communicationImpl()
 {
+  // Snapshot requests take over the say channel. Since a trainer message
+  // can be lost when the referee speaks in the same cycle, they are
+  // repeated until answered; the trainer answers repeats again.
+  if (!state_request.empty()) {
+    const long now = world().time().cycle();
+    if (state_request_time < 0 || now - state_request_time >= 5) {
+      addSayMessage(new Pooled< CustomMessage >(state_request));
+      state_request_time = now;
+    }
+    return;
+  }
   // Say the outgoing message
   if (!say_msg.empty()) {
-    addSayMessage(new CustomMessage(say_msg));
+    addSayMessage(new Pooled< CustomMessage >(say_msg));
     say_msg.clear();
   }
   // Disabled since it adds default communication messages which
@@ -634,11 +764,11 @@ Agent::doPreprocess()
                       __FILE__": tackle wait. expires= %d",
                       wm.self().tackleExpires() );
         // face neck to ball
-        this->setViewAction( new View_Tactical() );
+        this->setViewAction( new Pooled< View_Tactical >() );
 	if (wm.ball().posValid()) {
-	  this->setNeckAction( new Neck_TurnToBallOrScan() );
+	  this->setNeckAction( new Pooled< Neck_TurnToBallOrScan >() );
 	} else{
-	  this->setNeckAction( new Neck_TurnToBall() );
+	  this->setNeckAction( new Pooled< Neck_TurnToBall >() );
 	}
         return true;
     }
@@ -653,7 +783,7 @@ Agent::doPreprocess()
                       __FILE__": before_kick_off" );
         Vector2D move_point =  Strategy::i().getPosition( wm.self().unum() );
         Bhv_CustomBeforeKickOff( move_point ).execute( this );
-        this->setViewAction( new View_Tactical() );
+        this->setViewAction( new Pooled< View_Tactical >() );
         return true;
     }
 
@@ -679,7 +809,7 @@ Agent::doPreprocess()
     {
         dlog.addText( Logger::TEAM,
                       __FILE__": search ball" );
-        this->setViewAction( new View_Tactical() );
+        this->setViewAction( new Pooled< View_Tactical >() );
         return Bhv_NeckBodyToBall().execute( this );
     }
 
@@ -687,7 +817,7 @@ Agent::doPreprocess()
     // set default change view
     //
 
-    this->setViewAction( new View_Tactical() );
+    this->setViewAction( new Pooled< View_Tactical >() );
 
     //
     // check shoot chance
@@ -766,7 +896,7 @@ Agent::doReorient()
                       __FILE__": before_kick_off" );
         Vector2D move_point =  Strategy::i().getPosition( wm.self().unum() );
 	Bhv_CustomBeforeKickOff( move_point ).execute( this );
-        this->setViewAction( new View_Tactical() );
+        this->setViewAction( new Pooled< View_Tactical >() );
         return true;
     }
 
@@ -789,7 +919,7 @@ Agent::doReorient()
     // set default change view
     //
 
-    this->setViewAction( new View_Tactical() );
+    this->setViewAction( new Pooled< View_Tactical >() );
 
     //
     // ball localization error
@@ -914,7 +1044,7 @@ Agent::doDribble()
   Strategy::instance().update( world() );
   M_field_evaluator = createFieldEvaluator();
   CompositeActionGenerator * g = new CompositeActionGenerator();
-  g->addGenerator(new ActGen_MaxActionChainLengthFilter(new ActGen_ShortDribble(), 1));
+  g->addGenerator(new ActGen_MaxActionChainLengthFilter(new ActGen_Profile("ShortDribble", new ActGen_ShortDribble()), 1));
   M_action_generator = ActionGenerator::ConstPtr(g);
   ActionChainHolder::instance().setFieldEvaluator( M_field_evaluator );
   ActionChainHolder::instance().setActionGenerator( M_action_generator );
@@ -1158,7 +1288,7 @@ Agent::doForceKick()
 	Body_KickOneStep( goal_pos,
 			  ServerParam::i().ballSpeedMax()
 			  ).execute( this );
-        this->setNeckAction( new Neck_ScanField() );
+        this->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -1203,7 +1333,7 @@ Agent::doHeardPassReceive()
                       self_min );
         this->debugClient().addMessage( "Comm:Receive:Intercept" );
         Body_Intercept().execute( this );
-        this->setNeckAction( new Neck_TurnToBall() );
+        this->setNeckAction( new Pooled< Neck_TurnToBall >() );
     }
     else
     {
@@ -1216,14 +1346,14 @@ Agent::doHeardPassReceive()
                     0.5,
                         ServerParam::i().maxDashPower()
                         ).execute( this );
-        this->setNeckAction( new Neck_TurnToBall() );
+        this->setNeckAction( new Pooled< Neck_TurnToBall >() );
     }
 
-    this->setIntention( new IntentionReceive( heard_pos,
-                                              ServerParam::i().maxDashPower(),
-                                              0.9,
-                                              5,
-                                              wm.time() ) );
+    this->setIntention( new Pooled< IntentionReceive >( heard_pos,
+                                                        ServerParam::i().maxDashPower(),
+                                                        0.9,
+                                                        5,
+                                                        wm.time() ) );
 
     return true;
 }
@@ -1261,20 +1391,20 @@ Agent::createActionGenerator() const
     // shoot
     //
     g->addGenerator( new ActGen_RangeActionChainLengthFilter
-                     ( new ActGen_Shoot(),
+                     ( new ActGen_Profile( "Shoot", new ActGen_Shoot() ),
                        2, ActGen_RangeActionChainLengthFilter::MAX ) );
 
     //
     // strict check pass
     //
     g->addGenerator( new ActGen_MaxActionChainLengthFilter
-                     ( new ActGen_StrictCheckPass(), 1 ) );
+                     ( new ActGen_Profile( "StrictCheckPass", new ActGen_StrictCheckPass() ), 1 ) );
 
     //
     // cross
     //
     g->addGenerator( new ActGen_MaxActionChainLengthFilter
-                     ( new ActGen_Cross(), 1 ) );
+                     ( new ActGen_Profile( "Cross", new ActGen_Cross() ), 1 ) );
 
     //
     // direct pass
@@ -1287,13 +1417,13 @@ Agent::createActionGenerator() const
     // short dribble
     //
     g->addGenerator( new ActGen_MaxActionChainLengthFilter
-                     ( new ActGen_ShortDribble(), 1 ) );
+                     ( new ActGen_Profile( "ShortDribble", new ActGen_ShortDribble() ), 1 ) );
 
     //
     // self pass (long dribble)
     //
     g->addGenerator( new ActGen_MaxActionChainLengthFilter
-                     ( new ActGen_SelfPass(), 1 ) );
+                     ( new ActGen_Profile( "SelfPass", new ActGen_SelfPass() ), 1 ) );
 
     //
     // simple dribble
@@ -7,6 +7,7 @@
 #include "field_evaluator.h"
 #include "communication.h"
 #include "feature_extractor.h"
+#include "reward_function.h"
 #include "common.hpp"
 
 #include <rcsc/player/player_agent.h>
@@ -24,6 +25,9 @@ public:
                                                int num_opponents,
                                                bool playing_offense);
 
+  // Returns a new built-in reward function
+  static RewardFunction* getRewardFunction(hfo::reward_t reward_type);
+
   inline long statusUpdateTime() { return lastStatusUpdateTime; }
 
   // Process incoming trainer messages. Used to update the game status.
@@ -32,6 +36,9 @@ public:
   void ProcessTeammateMessages();
   // Update the state features from the world model.
   void UpdateFeatures();
+  // Add the reward of this cycle to the reward of the current step.
+  // Evaluated every cycle, also while features are not updated.
+  void UpdateReward();
 
 protected:
   // You can override this method. But you must call
@@ -66,6 +73,14 @@ protected:
   int num_teammates;                   // Number of teammates
   int num_opponents;                   // Number of opponents
   bool last_action_status;  // Recorded return status of last action
+  bool update_features;     // Extract the state features each cycle
+  RewardSum reward_function; // Rewards requested by the client
+  float reward;             // Reward accumulated since resetReward()
+  std::string state_request; // Pending snapshot request to the trainer
+  long state_request_time;   // Last time state_request was said
+  int state_request_seq;     // Tells consecutive requests apart
+  bool state_replied;        // The trainer answered state_request
+  int state_reply_id;        // Snapshot id of the answer, -1 on failure
 
  public:
   inline const std::vector<float>& getState() { return state; }
@@ -76,11 +91,31 @@ protected:
   inline int getNumTeammates() { return num_teammates; }
   inline int getNumOpponents() { return num_opponents; }
   inline bool getLastActionStatus() { return last_action_status; }
+  // Action-chain planner counters of the current episode
+  void getPlannerStats(std::vector<hfo::PlannerStats>* stats) const;
 
   inline void setFeatureSet(hfo::feature_set_t fset) { feature_set = fset; }
+  // Skips the feature extraction of the coming cycles while false, e.g.
+  // while an action is repeated. getState() keeps the last features.
+  inline void setUpdateFeatures(bool update) { update_features = update; }
+  // Adds weight times reward, which the agent takes ownership of, to the
+  // reward of each cycle
+  inline void addRewardFunction(RewardFunction* reward_fn, float weight) {
+    reward_function.add(reward_fn, weight);
+  }
+  inline float getReward() { return reward; }
+  inline void resetReward(float r = 0) { reward = r; }
   inline std::vector<float>* mutable_params() { return &params; }
   inline void setAction(hfo::action_t a) { requested_action = a; }
   inline void setSayMsg(const std::string& message) { say_msg = message; }
+  // Asks the trainer to snapshot, restore or drop a snapshot of the game
+  // state. The request takes over the say channel until the trainer
+  // answers.
+  void requestSaveState();
+  void requestRestoreState(int id);
+  void requestDropState(int id);
+  inline bool stateReplied() { return state_replied; }
+  inline int getStateReplyId() { return state_reply_id; }
 
  private:
   bool doPreprocess();
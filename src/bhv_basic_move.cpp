@@ -48,6 +48,7 @@
 #include <rcsc/common/server_param.h>
 
 #include "neck_offensive_intercept_neck.h"
+#include "pooled.h"
 
 using namespace rcsc;
 
@@ -85,7 +86,7 @@ Bhv_BasicMove::execute( PlayerAgent * agent )
         dlog.addText( Logger::TEAM,
                       __FILE__": intercept" );
         bool success = Body_Intercept().execute( agent );
-        agent->setNeckAction( new Neck_OffensiveInterceptNeck() );
+        agent->setNeckAction( new Pooled< Neck_OffensiveInterceptNeck >() );
         return success;
     }
 
@@ -120,11 +121,11 @@ Bhv_BasicMove::execute( PlayerAgent * agent )
 
     if ( wm.existKickableOpponent()
          && ball.distFromSelf() < 18.0 ) {
-      agent->setNeckAction( new Neck_TurnToBall() );
+      agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
     } else if ( ball.posValid() ) {
-      agent->setNeckAction( new Neck_TurnToBallOrScan() );
+      agent->setNeckAction( new Pooled< Neck_TurnToBallOrScan >() );
     } else {
-      agent->setNeckAction( new Neck_TurnToBall() );
+      agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
     }
 
 
@@ -29,6 +29,7 @@
 #endif
 
 #include "bhv_basic_offensive_kick.h"
+#include "pooled.h"
 
 #include <rcsc/action/body_advance_ball.h>
 #include <rcsc/action/body_dribble.h>
@@ -93,7 +94,7 @@ Bhv_BasicOffensiveKick::execute( PlayerAgent * agent )
                               __FILE__": (execute) do best pass" );
                 agent->debugClient().addMessage( "OffKickPass(1)" );
                 Body_Pass().execute( agent );
-                agent->setNeckAction( new Neck_TurnToLowConfTeammate() );
+                agent->setNeckAction( new Pooled< Neck_TurnToLowConfTeammate >() );
                 return true;
             }
         }
@@ -106,7 +107,7 @@ Bhv_BasicOffensiveKick::execute( PlayerAgent * agent )
             dlog.addText( Logger::TEAM,
                           __FILE__": (execute) do best pass" );
             agent->debugClient().addMessage( "OffKickPass(2)" );
-            agent->setNeckAction( new Neck_TurnToLowConfTeammate() );
+            agent->setNeckAction( new Pooled< Neck_TurnToLowConfTeammate >() );
             return true;
         }
     }
@@ -146,7 +147,7 @@ Bhv_BasicOffensiveKick::execute( PlayerAgent * agent )
                               ServerParam::i().maxDashPower(),
                               2
                               ).execute( agent );
-                agent->setNeckAction( new Neck_TurnToLowConfTeammate() );
+                agent->setNeckAction( new Pooled< Neck_TurnToLowConfTeammate >() );
                 return true;
             }
         }
@@ -202,7 +203,7 @@ Bhv_BasicOffensiveKick::execute( PlayerAgent * agent )
                           ).execute( agent );
 
         }
-        agent->setNeckAction( new Neck_TurnToLowConfTeammate() );
+        agent->setNeckAction( new Pooled< Neck_TurnToLowConfTeammate >() );
         return true;
     }
 
@@ -218,7 +219,7 @@ Bhv_BasicOffensiveKick::execute( PlayerAgent * agent )
                       ServerParam::i().maxDashPower() * 0.4,
                       1
                       ).execute( agent );
-        agent->setNeckAction( new Neck_TurnToLowConfTeammate() );
+        agent->setNeckAction( new Pooled< Neck_TurnToLowConfTeammate >() );
         return true;
     }
 
@@ -231,7 +232,7 @@ Bhv_BasicOffensiveKick::execute( PlayerAgent * agent )
                       __FILE__": (execute) pass",
                       __LINE__ );
         agent->debugClient().addMessage( "OffKickPass(3)" );
-        agent->setNeckAction( new Neck_TurnToLowConfTeammate() );
+        agent->setNeckAction( new Pooled< Neck_TurnToLowConfTeammate >() );
         return true;
     }
 
@@ -247,7 +248,7 @@ Bhv_BasicOffensiveKick::execute( PlayerAgent * agent )
                       ServerParam::i().maxDashPower() * 0.2,
                       1
                       ).execute( agent );
-        agent->setNeckAction( new Neck_TurnToLowConfTeammate() );
+        agent->setNeckAction( new Pooled< Neck_TurnToLowConfTeammate >() );
         return true;
     }
 
@@ -257,7 +258,7 @@ Bhv_BasicOffensiveKick::execute( PlayerAgent * agent )
                       __FILE__": hold" );
         agent->debugClient().addMessage( "OffKickHold" );
         Body_HoldBall().execute( agent );
-        agent->setNeckAction( new Neck_TurnToLowConfTeammate() );
+        agent->setNeckAction( new Pooled< Neck_TurnToLowConfTeammate >() );
         return true;
     }
 
@@ -266,7 +267,7 @@ Bhv_BasicOffensiveKick::execute( PlayerAgent * agent )
                       __FILE__": clear" );
         agent->debugClient().addMessage( "OffKickAdvance" );
         Body_AdvanceBall().execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
     }
 
     return true;
@@ -31,6 +31,7 @@
 #include "bhv_basic_tackle.h"
 
 #include "tackle_generator.h"
+#include "pooled.h"
 
 #include <rcsc/action/neck_turn_to_ball_or_scan.h>
 #include <rcsc/action/neck_turn_to_point.h>
@@ -163,7 +164,7 @@ Bhv_BasicTackle::executeOld( PlayerAgent * agent )
         agent->debugClient().addMessage( "Tackle+" );
 
         agent->doTackle( tackle_power );
-        agent->setNeckAction( new Neck_TurnToBallOrScan() );
+        agent->setNeckAction( new Pooled< Neck_TurnToBallOrScan >() );
         return true;
     }
 
@@ -177,7 +178,7 @@ Bhv_BasicTackle::executeOld( PlayerAgent * agent )
         agent->debugClient().addMessage( "Tackle-" );
 
         agent->doTackle( tackle_power );
-        agent->setNeckAction( new Neck_TurnToBallOrScan() );
+        agent->setNeckAction( new Pooled< Neck_TurnToBallOrScan >() );
         return true;
     }
 
@@ -219,7 +220,7 @@ Bhv_BasicTackle::executeV12( PlayerAgent * agent )
 
             double tackle_dir = ( s_best_angle - wm.self().body() ).degree();
             agent->doTackle( tackle_dir );
-            agent->setNeckAction( new Neck_TurnToBallOrScan() );
+            agent->setNeckAction( new Pooled< Neck_TurnToBallOrScan >() );
         }
         return s_result;
     }
@@ -380,7 +381,7 @@ Bhv_BasicTackle::executeV12( PlayerAgent * agent )
 
     double tackle_dir = ( best_angle - wm.self().body() ).degree();
     agent->doTackle( tackle_dir );
-    agent->setNeckAction( new Neck_TurnToBallOrScan() );
+    agent->setNeckAction( new Pooled< Neck_TurnToBallOrScan >() );
 
     return true;
 }
@@ -413,7 +414,7 @@ Bhv_BasicTackle::executeV14( PlayerAgent * agent,
     double tackle_dir = ( result.tackle_angle_ - wm.self().body() ).degree();
 
     agent->doTackle( tackle_dir, use_foul );
-    agent->setNeckAction( new Neck_TurnToPoint( ball_next ) );
+    agent->setNeckAction( new Pooled< Neck_TurnToPoint >( ball_next ) );
 
     return true;
 }
@@ -3,6 +3,7 @@
 #endif
 
 #include "bhv_force_pass.h"
+#include "pooled.h"
 
 #include <rcsc/action/body_kick_one_step.h>
 #include <rcsc/action/body_smart_kick.h>
@@ -103,10 +104,10 @@ Force_Pass::execute( PlayerAgent * agent )
         Vector2D target_buf = target_point - agent->world().self().pos();
         target_buf.setLength( 1.0 );
 
-        agent->addSayMessage( new PassMessage( receiver,
-                                               target_point + target_buf,
-                                               agent->effector().queuedNextBallPos(),
-                                               agent->effector().queuedNextBallVel() ) );
+        agent->addSayMessage( new Pooled< PassMessage >( receiver,
+                                                         target_point + target_buf,
+                                                         agent->effector().queuedNextBallPos(),
+                                                         agent->effector().queuedNextBallVel() ) );
     }
 
     return true;
@@ -31,6 +31,7 @@
 #include "bhv_go_to_static_ball.h"
 
 #include "bhv_set_play.h"
+#include "pooled.h"
 
 #include <rcsc/action/basic_actions.h>
 #include <rcsc/action/body_go_to_point.h>
@@ -113,7 +114,7 @@ Bhv_GoToStaticBall::execute( PlayerAgent * agent )
         }
     }
 
-    agent->setNeckAction( new Neck_ScanField() );
+    agent->setNeckAction( new Pooled< Neck_ScanField >() );
 
     return true;
 }
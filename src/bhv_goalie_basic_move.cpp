@@ -32,6 +32,7 @@
 
 #include "bhv_basic_tackle.h"
 #include "neck_goalie_turn_neck.h"
+#include "pooled.h"
 
 #include <rcsc/action/basic_actions.h>
 #include <rcsc/action/body_go_to_point.h>
@@ -128,7 +129,7 @@ Bhv_GoalieBasicMove::execute( PlayerAgent * agent )
     agent->debugClient().addMessage( "OnlyTurnNeck" );
 
     agent->doTurn( 0.0 );
-    agent->setNeckAction( new Neck_GoalieTurnNeck() );
+    agent->setNeckAction( new Pooled< Neck_GoalieTurnNeck >() );
 
     return true;
 }
@@ -393,7 +394,7 @@ Bhv_GoalieBasicMove::doPrepareDeepCross( PlayerAgent * agent,
     agent->debugClient().setTarget( move_point );
 
     Body_TurnToAngle( body_angle ).execute( agent );
-    agent->setNeckAction( new Neck_GoalieTurnNeck() );
+    agent->setNeckAction( new Pooled< Neck_GoalieTurnNeck >() );
     return true;
 }
 
@@ -437,7 +438,7 @@ Bhv_GoalieBasicMove::doStopAtMovePoint( PlayerAgent * agent,
         agent->debugClient().setTarget( move_point );
 
         Body_StopDash( true ).execute( agent ); // save recovery
-        agent->setNeckAction( new Neck_GoalieTurnNeck() );
+        agent->setNeckAction( new Pooled< Neck_GoalieTurnNeck >() );
         return true;
     }
 
@@ -556,7 +557,7 @@ Bhv_GoalieBasicMove::doCorrectX( PlayerAgent * agent,
                 Body_TurnToAngle( body_angle ).execute( agent );
 
             }
-            agent->setNeckAction( new Neck_TurnToBall() );
+            agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
             return true;
         }
 
@@ -636,7 +637,7 @@ Bhv_GoalieBasicMove::doCorrectBodyDir( PlayerAgent * agent,
         agent->debugClient().addMessage( "CorrectBody%s",
                                          consider_opp ? "WithOpp" : "" );
         Body_TurnToAngle( target_angle ).execute( agent );
-        agent->setNeckAction( new Neck_GoalieTurnNeck() );
+        agent->setNeckAction( new Pooled< Neck_GoalieTurnNeck >() );
         return true;
     }
 
@@ -708,7 +709,7 @@ Bhv_GoalieBasicMove::doGoToMovePoint( PlayerAgent * agent,
         agent->debugClient().setTarget( move_point );
 
         agent->doDash( dash_power );
-        agent->setNeckAction( new Neck_GoalieTurnNeck() );
+        agent->setNeckAction( new Pooled< Neck_GoalieTurnNeck >() );
     }
     else
     {
@@ -773,6 +774,6 @@ Bhv_GoalieBasicMove::doGoToPointLookBall( PlayerAgent * agent,
                           body_angle.degree() );
         }
 
-        agent->setNeckAction( new Neck_TurnToBall() );
+        agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
     }
 }
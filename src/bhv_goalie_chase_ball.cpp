@@ -32,6 +32,7 @@
 
 #include "bhv_goalie_basic_move.h"
 #include "bhv_basic_tackle.h"
+#include "pooled.h"
 
 #include <rcsc/action/basic_actions.h>
 #include <rcsc/action/body_go_to_point.h>
@@ -99,7 +100,7 @@ Bhv_GoalieChaseBall::execute( PlayerAgent * agent )
                       __FILE__": execute normal intercept" );
         agent->debugClient().addMessage( "Intercept(0)" );
         Body_Intercept( save_recovery ).execute( agent );
-        agent->setNeckAction( new Neck_TurnToBall() );
+        agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
         return true;
     }
 
@@ -125,7 +126,7 @@ Bhv_GoalieChaseBall::execute( PlayerAgent * agent )
                     dlog.addText( Logger::TEAM,
                                   __FILE__": execute normal interception" );
                     agent->debugClient().addMessage( "Intercept(1)" );
-                    agent->setNeckAction( new Neck_TurnToBall() );
+                    agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
                     return true;
                 }
             }
@@ -158,7 +159,7 @@ Bhv_GoalieChaseBall::execute( PlayerAgent * agent )
         if ( Body_Intercept( false ).execute( agent ) )
         {
             agent->debugClient().addMessage( "Intercept(2)" );
-            agent->setNeckAction( new Neck_TurnToBall() );
+            agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
             return true;
         }
         else
@@ -181,7 +182,7 @@ Bhv_GoalieChaseBall::execute( PlayerAgent * agent )
     {
         agent->debugClient().addMessage( "StopForChase" );
         Body_StopDash( false ).execute( agent );
-        agent->setNeckAction( new Neck_TurnToBall() );
+        agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
         return true;
     }
 
@@ -291,7 +292,7 @@ Bhv_GoalieChaseBall::doGoToCatchPoint( PlayerAgent * agent,
         agent->doTurn( rel_angle );
     }
 
-    agent->setNeckAction( new Neck_TurnToBall() );
+    agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
 }
 
 /*-------------------------------------------------------------------*/
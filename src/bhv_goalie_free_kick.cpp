@@ -31,6 +31,7 @@
 #include "bhv_goalie_free_kick.h"
 
 #include "bhv_goalie_basic_move.h"
+#include "pooled.h"
 
 #include <rcsc/action/body_clear_ball.h>
 #include <rcsc/action/body_pass.h>
@@ -104,7 +105,7 @@ Bhv_GoalieFreeKick::execute( rcsc::PlayerAgent * agent )
         s_second_move = false;
         s_second_wait_count = 0;
         agent->doMove( move_target.x, move_target.y );
-        agent->setNeckAction( new rcsc::Neck_ScanField );
+        agent->setNeckAction( new Pooled< rcsc::Neck_ScanField > );
         return true;
     }
 
@@ -130,7 +131,7 @@ Bhv_GoalieFreeKick::execute( rcsc::PlayerAgent * agent )
     {
         rcsc::Vector2D kick_point = getKickPoint( agent );
         agent->doMove( kick_point.x, kick_point.y );
-        agent->setNeckAction( new rcsc::Neck_ScanField );
+        agent->setNeckAction( new Pooled< rcsc::Neck_ScanField > );
         s_second_move = true;
         s_second_wait_count = 0;
         return true;
@@ -229,13 +230,13 @@ Bhv_GoalieFreeKick::doKick( rcsc::PlayerAgent * agent )
                                 __FILE__": register goalie kick intention. to (%.1f, %.1f)",
                                 target_point.x,
                                 target_point.y );
-            agent->setNeckAction( new rcsc::Neck_ScanField() );
+            agent->setNeckAction( new Pooled< rcsc::Neck_ScanField >() );
             return;
         }
     }
 
     rcsc::Body_ClearBall().execute( agent );
-    agent->setNeckAction( new rcsc::Neck_ScanField() );
+    agent->setNeckAction( new Pooled< rcsc::Neck_ScanField >() );
 }
 
 /*-------------------------------------------------------------------*/
@@ -258,5 +259,5 @@ Bhv_GoalieFreeKick::doWait( rcsc::PlayerAgent * agent )
     }
 
     rcsc::Body_TurnToPoint( face_target ).execute( agent );
-    agent->setNeckAction( new rcsc::Neck_ScanField() );
+    agent->setNeckAction( new Pooled< rcsc::Neck_ScanField >() );
 }
@@ -35,6 +35,7 @@
 #include "bhv_goalie_chase_ball.h"
 #include "bhv_goalie_basic_move.h"
 #include "bhv_go_to_static_ball.h"
+#include "pooled.h"
 
 #include <rcsc/action/body_clear_ball.h>
 #include <rcsc/action/body_dribble2008.h>
@@ -183,7 +184,7 @@ Bhv_PenaltyKick::doKickerWait( PlayerAgent * agent )
                         0.3,
                         ServerParam::i().maxDashPower()
                         ).execute( agent );
-        agent->setNeckAction( new Neck_TurnToRelative( 0.0 ) );
+        agent->setNeckAction( new Pooled< Neck_TurnToRelative >( 0.0 ) );
     }
 #else
     const WorldModel & wm = agent->world();
@@ -238,7 +239,7 @@ Bhv_PenaltyKick::doKickerWait( PlayerAgent * agent )
                     0.5,
                     ServerParam::i().maxDashPower()
                     ).execute( agent );
-    agent->setNeckAction( new Neck_TurnToRelative( 0.0 ) );
+    agent->setNeckAction( new Pooled< Neck_TurnToRelative >( 0.0 ) );
 #endif
     return true;
 }
@@ -260,11 +261,11 @@ Bhv_PenaltyKick::doKickerSetup( PlayerAgent * agent )
         Body_TurnToPoint( goal_c ).execute( agent );
         if ( opp_goalie )
         {
-            agent->setNeckAction( new Neck_TurnToPoint( opp_goalie->pos() ) );
+            agent->setNeckAction( new Pooled< Neck_TurnToPoint >( opp_goalie->pos() ) );
         }
         else
         {
-            agent->setNeckAction( new Neck_TurnToPoint( goal_c ) );
+            agent->setNeckAction( new Pooled< Neck_TurnToPoint >( goal_c ) );
         }
     }
 
@@ -331,18 +332,18 @@ Bhv_PenaltyKick::doKicker( PlayerAgent * agent )
 
         if ( wm.ball().posCount() > 0 )
         {
-            agent->setNeckAction( new Neck_TurnToBall() );
+            agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
         }
         else
         {
             const PlayerObject * opp_goalie = agent->world().getOpponentGoalie();
             if ( opp_goalie )
             {
-                agent->setNeckAction( new Neck_TurnToPoint( opp_goalie->pos() ) );
+                agent->setNeckAction( new Pooled< Neck_TurnToPoint >( opp_goalie->pos() ) );
             }
             else
             {
-                agent->setNeckAction( new Neck_ScanField() );
+                agent->setNeckAction( new Pooled< Neck_ScanField >() );
             }
         }
 
@@ -380,7 +381,7 @@ Bhv_PenaltyKick::doOneKickShoot( PlayerAgent* agent )
                         0.4,
                         ServerParam::i().maxDashPower()
                         ).execute( agent );
-        agent->setNeckAction( new Neck_TurnToBall() );
+        agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
         return true;
     }
 
@@ -392,12 +393,12 @@ Bhv_PenaltyKick::doOneKickShoot( PlayerAgent* agent )
         const PlayerObject * opp_goalie = agent->world().getOpponentGoalie();
         if ( opp_goalie )
         {
-            agent->setNeckAction( new Neck_TurnToPoint( opp_goalie->pos() ) );
+            agent->setNeckAction( new Pooled< Neck_TurnToPoint >( opp_goalie->pos() ) );
         }
         else
         {
             Vector2D goal_c = ServerParam::i().theirTeamGoalPos();
-            agent->setNeckAction( new Neck_TurnToPoint( goal_c ) );
+            agent->setNeckAction( new Pooled< Neck_TurnToPoint >( goal_c ) );
         }
         return true;
     }
@@ -467,7 +468,7 @@ Bhv_PenaltyKick::doShoot( PlayerAgent * agent )
                         shot_speed,
                         shot_speed * 0.96,
                         2 ).execute( agent );
-        agent->setNeckAction( new Neck_TurnToPoint( shot_point ) );
+        agent->setNeckAction( new Pooled< Neck_TurnToPoint >( shot_point ) );
         return true;
     }
 
@@ -828,11 +829,11 @@ Bhv_PenaltyKick::doDribble( PlayerAgent * agent )
 
     if ( opp_goalie )
     {
-        agent->setNeckAction( new Neck_TurnToPoint( opp_goalie->pos() ) );
+        agent->setNeckAction( new Pooled< Neck_TurnToPoint >( opp_goalie->pos() ) );
     }
     else
     {
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
     }
 
     return true;
@@ -872,7 +873,7 @@ Bhv_PenaltyKick::doGoalieWait( PlayerAgent* agent )
     if ( agent->world().self().pos().dist2( wait_pos ) < 1.0 )
     {
         Body_TurnToPoint( face_point ).execute( agent );
-        agent->setNeckAction( new Neck_TurnToBall() );
+        agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
     }
     else
     {
@@ -880,11 +881,11 @@ Bhv_PenaltyKick::doGoalieWait( PlayerAgent* agent )
                         0.5,
                         dash_power
                         ).execute( agent );
-        agent->setNeckAction( new Neck_TurnToPoint( face_point ) );
+        agent->setNeckAction( new Pooled< Neck_TurnToPoint >( face_point ) );
     }
 #else
     Body_TurnToBall().execute( agent );
-    agent->setNeckAction( new Neck_TurnToBall() );
+    agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
 #endif
     return true;
 }
@@ -904,7 +905,7 @@ Bhv_PenaltyKick::doGoalieSetup( PlayerAgent * agent )
                          ServerParam::i().maxDashPower()
                          ).execute( agent ) )
     {
-        agent->setNeckAction( new Neck_TurnToBall() );
+        agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
         return true;
     }
 
@@ -915,7 +916,7 @@ Bhv_PenaltyKick::doGoalieSetup( PlayerAgent * agent )
         Body_TurnToPoint( face_point ).execute( agent );
     }
 
-    agent->setNeckAction( new Neck_TurnToBall() );
+    agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
 
     return true;
 }
@@ -948,7 +949,7 @@ Bhv_PenaltyKick::doGoalie( PlayerAgent* agent )
     if ( wm.self().isKickable() )
     {
         Body_ClearBall().execute( agent );
-        agent->setNeckAction( new Neck_TurnToBall() );
+        agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
         return true;
     }
 
@@ -1008,7 +1009,7 @@ Bhv_PenaltyKick::doGoalieBasicMove( PlayerAgent * agent )
                 agent->debugClient().addMessage( "Intercept" );
                 dlog.addText( Logger::TEAM,
                               __FILE__": goalieBasicMove. do intercept " );
-                agent->setNeckAction( new Neck_TurnToBall() );
+                agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
                 return true;
             }
         }
@@ -1055,7 +1056,7 @@ Bhv_PenaltyKick::doGoalieBasicMove( PlayerAgent * agent )
         }
         Body_TurnToAngle( face_angle ).execute( agent );
     }
-    agent->setNeckAction( new Neck_TurnToBall() );
+    agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
 
     return true;
 }
@@ -1197,7 +1198,7 @@ Bhv_PenaltyKick::doGoalieSlideChase( PlayerAgent* agent )
             face_point.y = -100.0;
         }
         Body_TurnToPoint( face_point ).execute( agent );
-        agent->setNeckAction( new Neck_TurnToBall() );
+        agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
         return true;
     }
 
@@ -1210,7 +1211,7 @@ Bhv_PenaltyKick::doGoalieSlideChase( PlayerAgent* agent )
          || ! ball_ray.inRightDir( intersection ) )
     {
         Body_Intercept( false ).execute( agent ); // goalie mode
-        agent->setNeckAction( new Neck_TurnToBall() );
+        agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
         return true;
     }
 
@@ -1218,7 +1219,7 @@ Bhv_PenaltyKick::doGoalieSlideChase( PlayerAgent* agent )
          < ServerParam::i().catchAreaLength() * 0.7 )
     {
         Body_StopDash( false ).execute( agent ); // not save recovery
-        agent->setNeckAction( new Neck_TurnToBall() );
+        agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
         return true;
     }
 
@@ -1229,6 +1230,6 @@ Bhv_PenaltyKick::doGoalieSlideChase( PlayerAgent* agent )
         dash_power = ServerParam::i().minDashPower();
     }
     agent->doDash( dash_power );
-    agent->setNeckAction( new Neck_TurnToBall() );
+    agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
     return true;
 }
@@ -32,6 +32,7 @@
 
 #include "bhv_go_to_static_ball.h"
 #include "bhv_set_play.h"
+#include "pooled.h"
 
 #include <rcsc/action/basic_actions.h>
 #include <rcsc/action/neck_scan_field.h>
@@ -91,7 +92,7 @@ Bhv_PrepareSetPlayKick::execute( PlayerAgent * agent )
             Body_TurnToBall().execute( agent );
         }
 
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         s_rest_wait_cycle--;
 
         dlog.addText( Logger::TEAM,
@@ -39,6 +39,7 @@
 #include "bhv_set_play_kick_in.h"
 #include "bhv_set_play_indirect_free_kick.h"
 #include "bhv_their_goal_kick_move.h"
+#include "pooled.h"
 
 #include <rcsc/action/basic_actions.h>
 #include <rcsc/action/bhv_before_kick_off.h>
@@ -695,5 +696,5 @@ Bhv_SetPlay::doBasicTheirSetPlayMove( PlayerAgent * agent )
         Body_TurnToAngle( body_angle ).execute( agent );
     }
 
-    agent->setNeckAction( new Neck_TurnToBall() );
+    agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
 }
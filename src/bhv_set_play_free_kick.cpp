@@ -38,6 +38,7 @@
 #include "bhv_chain_action.h"
 
 #include "intention_wait_after_set_play_kick.h"
+#include "pooled.h"
 
 #include <rcsc/action/basic_actions.h>
 #include <rcsc/action/body_go_to_point.h>
@@ -119,7 +120,7 @@ Bhv_SetPlayFreeKick::doKick( PlayerAgent * agent )
     if ( Bhv_ChainAction().execute( agent ) )
     {
         agent->debugClient().addMessage( "FreeKick:Chain" );
-        agent->setIntention( new IntentionWaitAfterSetPlayKick() );
+        agent->setIntention( new Pooled< IntentionWaitAfterSetPlayKick >() );
         return;
     }
     // {
@@ -192,7 +193,7 @@ Bhv_SetPlayFreeKick::doKick( PlayerAgent * agent )
                           ball_speed, ball_reach_step );
 
             Body_KickOneStep( target_point, ball_speed ).execute( agent );
-            agent->setNeckAction( new Neck_ScanField() );
+            agent->setNeckAction( new Pooled< Neck_ScanField >() );
             return;
         }
     }
@@ -208,7 +209,7 @@ Bhv_SetPlayFreeKick::doKick( PlayerAgent * agent )
                       __FILE__":  clear. turn to ball" );
 
         Body_TurnToBall().execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return;
     }
 
@@ -217,7 +218,7 @@ Bhv_SetPlayFreeKick::doKick( PlayerAgent * agent )
                   __FILE__":  clear" );
 
     Body_ClearBall().execute( agent );
-    agent->setNeckAction( new Neck_ScanField() );
+    agent->setNeckAction( new Pooled< Neck_ScanField >() );
 }
 
 /*-------------------------------------------------------------------*/
@@ -250,7 +251,7 @@ Bhv_SetPlayFreeKick::doKickWait( PlayerAgent * agent )
     if ( wm.time().stopped() != 0 )
     {
         Body_TurnToPoint( face_point ).execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -261,7 +262,7 @@ Bhv_SetPlayFreeKick::doKickWait( PlayerAgent * agent )
                       __FILE__": (doKickWait) delaying" );
 
         Body_TurnToPoint( face_point ).execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -272,7 +273,7 @@ Bhv_SetPlayFreeKick::doKickWait( PlayerAgent * agent )
                       __FILE__": (doKickWait) no teammate" );
 
         Body_TurnToPoint( face_point ).execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -281,7 +282,7 @@ Bhv_SetPlayFreeKick::doKickWait( PlayerAgent * agent )
         agent->debugClient().addMessage( "FreeKick:Wait%d", wm.setplayCount() );
 
         Body_TurnToPoint( face_point ).execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -300,7 +301,7 @@ Bhv_SetPlayFreeKick::doKickWait( PlayerAgent * agent )
         agent->debugClient().addMessage( "FreeKick:Turn" );
 
         Body_TurnToPoint( face_point ).execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -308,7 +309,7 @@ Bhv_SetPlayFreeKick::doKickWait( PlayerAgent * agent )
          || wm.self().stamina() < ServerParam::i().staminaMax() * 0.9 )
     {
         Body_TurnToBall().execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
 
         agent->debugClient().addMessage( "FreeKick:Wait%d", wm.setplayCount() );
         dlog.addText( Logger::TEAM,
@@ -394,9 +395,9 @@ Bhv_SetPlayFreeKick::doMove( PlayerAgent * agent )
         if ( ! wm.self().staminaModel().capacityIsEmpty() )
         {
             agent->debugClient().addMessage( "Sayw" );
-            agent->addSayMessage( new WaitRequestMessage() );
+            agent->addSayMessage( new Pooled< WaitRequestMessage >() );
         }
     }
 
-    agent->setNeckAction( new Neck_TurnToBallOrScan() );
+    agent->setNeckAction( new Pooled< Neck_TurnToBallOrScan >() );
 }
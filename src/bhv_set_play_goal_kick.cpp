@@ -38,6 +38,7 @@
 #include "bhv_go_to_static_ball.h"
 
 #include "intention_wait_after_set_play_kick.h"
+#include "pooled.h"
 
 #include <rcsc/action/body_clear_ball.h>
 #include <rcsc/action/body_stop_ball.h>
@@ -131,7 +132,7 @@ Bhv_SetPlayGoalKick::doKick( PlayerAgent * agent )
     {
         agent->debugClient().addMessage( "GoalKick:FinalWait%d", real_set_play_count );
         Body_TurnToBall().execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return;
     }
 
@@ -140,7 +141,7 @@ Bhv_SetPlayGoalKick::doKick( PlayerAgent * agent )
                   __FILE__": clear ball" );
 
     Body_ClearBall().execute( agent );
-    agent->setNeckAction( new Neck_ScanField() );
+    agent->setNeckAction( new Pooled< Neck_ScanField >() );
 }
 
 
@@ -175,7 +176,7 @@ Bhv_SetPlayGoalKick::doSecondKick( PlayerAgent * agent )
                       __FILE__": (doSecondKick) clear ball" );
 
         Body_ClearBall().execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -201,7 +202,7 @@ Bhv_SetPlayGoalKick::doSecondKick( PlayerAgent * agent )
         Body_TurnToPoint( Vector2D( 0.0, 0.0 ) ).execute( agent );
     }
 
-    agent->setNeckAction( new Neck_ScanField() );
+    agent->setNeckAction( new Pooled< Neck_ScanField >() );
 
     return true;
 }
@@ -233,7 +234,7 @@ Bhv_SetPlayGoalKick::doKickWait( PlayerAgent * agent )
                       __FILE__": (doKickWait) delaying" );
 
         Body_TurnToBall().execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -242,7 +243,7 @@ Bhv_SetPlayGoalKick::doKickWait( PlayerAgent * agent )
     {
         agent->debugClient().addMessage( "GoalKick:TurnToBall" );
         Body_TurnToBall().execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -250,7 +251,7 @@ Bhv_SetPlayGoalKick::doKickWait( PlayerAgent * agent )
     {
         agent->debugClient().addMessage( "GoalKick:Wait%d", wm.setplayCount() );
         Body_TurnToBall().execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -259,7 +260,7 @@ Bhv_SetPlayGoalKick::doKickWait( PlayerAgent * agent )
     {
         agent->debugClient().addMessage( "GoalKick:NoTeammate%d", wm.setplayCount() );
         Body_TurnToBall().execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -278,7 +279,7 @@ Bhv_SetPlayGoalKick::doKickWait( PlayerAgent * agent )
          || wm.self().stamina() < ServerParam::i().staminaMax() * 0.9 )
     {
         Body_TurnToBall().execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
 
         agent->debugClient().addMessage( "GoalKick:Wait%d", wm.setplayCount() );
         dlog.addText( Logger::TEAM,
@@ -298,7 +299,7 @@ Bhv_SetPlayGoalKick::doPass( PlayerAgent * agent )
 {
     if ( Bhv_ChainAction().execute( agent ) )
     {
-        agent->setIntention( new IntentionWaitAfterSetPlayKick() );
+        agent->setIntention( new Pooled< IntentionWaitAfterSetPlayKick >() );
         return true;
     }
 
@@ -392,7 +393,7 @@ Bhv_SetPlayGoalKick::doIntercept( PlayerAgent * agent )
                       __FILE__": (doIntercept) intercept" );
 
         Body_Intercept().execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -475,11 +476,11 @@ Bhv_SetPlayGoalKick::doMove( PlayerAgent * agent )
         if ( ! wm.self().staminaModel().capacityIsEmpty() )
         {
             agent->debugClient().addMessage( "Sayw" );
-            agent->addSayMessage( new WaitRequestMessage() );
+            agent->addSayMessage( new Pooled< WaitRequestMessage >() );
         }
     }
 
-    agent->setNeckAction( new Neck_ScanField() );
+    agent->setNeckAction( new Pooled< Neck_ScanField >() );
 }
 
 /*-------------------------------------------------------------------*/
@@ -527,6 +528,6 @@ Bhv_SetPlayGoalKick::doKickToFarSide( PlayerAgent * agent )
 
     agent->doKick( kick_power, kick_angle - wm.self().body() );
 
-    agent->setNeckAction( new Neck_ScanField() );
+    agent->setNeckAction( new Pooled< Neck_ScanField >() );
     return true;
 }
@@ -38,6 +38,7 @@
 #include "bhv_chain_action.h"
 
 #include "intention_wait_after_set_play_kick.h"
+#include "pooled.h"
 
 #include <rcsc/action/basic_actions.h>
 #include <rcsc/action/body_go_to_point.h>
@@ -142,7 +143,7 @@ Bhv_SetPlayIndirectFreeKick::doKicker( PlayerAgent * agent )
     //
     if ( Bhv_ChainAction().execute( agent ) )
     {
-        agent->setIntention( new IntentionWaitAfterSetPlayKick() );
+        agent->setIntention( new Pooled< IntentionWaitAfterSetPlayKick >() );
         return;
     }
     // {
@@ -174,7 +175,7 @@ Bhv_SetPlayIndirectFreeKick::doKicker( PlayerAgent * agent )
     if ( wm.setplayCount() <= 3 )
     {
         Body_TurnToPoint( Vector2D( 50.0, 0.0 ) ).execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return;
     }
 
@@ -194,7 +195,7 @@ Bhv_SetPlayIndirectFreeKick::doKicker( PlayerAgent * agent )
                           __FILE__": (doKick) real set play count = %d <= drop_time-3, wait...",
                           real_set_play_count );
             Body_TurnToPoint( Vector2D( 50.0, 0.0 ) ).execute( agent );
-            agent->setNeckAction( new Neck_ScanField() );
+            agent->setNeckAction( new Pooled< Neck_ScanField >() );
             return;
         }
 
@@ -211,7 +212,7 @@ Bhv_SetPlayIndirectFreeKick::doKicker( PlayerAgent * agent )
                       ball_speed );
 
         Body_KickOneStep( target_point, ball_speed ).execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return;
     }
 
@@ -271,9 +272,9 @@ Bhv_SetPlayIndirectFreeKick::doKicker( PlayerAgent * agent )
 
 
     Body_KickOneStep( target_point, ball_speed ).execute( agent );
-    agent->setNeckAction( new Neck_ScanField() );
-    agent->addSayMessage( new BallMessage( agent->effector().queuedNextBallPos(),
-                                           agent->effector().queuedNextBallVel() ) );
+    agent->setNeckAction( new Pooled< Neck_ScanField >() );
+    agent->addSayMessage( new Pooled< BallMessage >( agent->effector().queuedNextBallPos(),
+                                                     agent->effector().queuedNextBallVel() ) );
 }
 
 /*-------------------------------------------------------------------*/
@@ -301,7 +302,7 @@ Bhv_SetPlayIndirectFreeKick::doKickWait( PlayerAgent * agent )
                       __FILE__": (doKickWait) stoppage time" );
 
         Body_TurnToPoint( face_point ).execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -314,7 +315,7 @@ Bhv_SetPlayIndirectFreeKick::doKickWait( PlayerAgent * agent )
         agent->debugClient().setTarget( face_point );
 
         Body_TurnToPoint( face_point ).execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -328,7 +329,7 @@ Bhv_SetPlayIndirectFreeKick::doKickWait( PlayerAgent * agent )
         agent->debugClient().setTarget( face_point );
 
         Body_TurnToPoint( face_point ).execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -410,7 +411,7 @@ Bhv_SetPlayIndirectFreeKick::doKickToShooter( PlayerAgent * agent )
                   ball_speed, ball_reach_step );
 
     Body_KickOneStep( target_point, ball_speed ).execute( agent );
-    agent->setNeckAction( new Neck_ScanField() );
+    agent->setNeckAction( new Pooled< Neck_ScanField >() );
 
     return true;
 
@@ -557,11 +558,11 @@ Bhv_SetPlayIndirectFreeKick::doOffenseMove( PlayerAgent * agent )
         if ( ! wm.self().staminaModel().capacityIsEmpty() )
         {
             agent->debugClient().addMessage( "Sayw" );
-            agent->addSayMessage( new WaitRequestMessage() );
+            agent->addSayMessage( new Pooled< WaitRequestMessage >() );
         }
     }
 
-    agent->setNeckAction( new Neck_TurnToBallOrScan() );
+    agent->setNeckAction( new Pooled< Neck_TurnToBallOrScan >() );
 }
 
 /*-------------------------------------------------------------------*/
@@ -662,5 +663,5 @@ Bhv_SetPlayIndirectFreeKick::doDefenseMove( PlayerAgent * agent )
                       __FILE__":  their kick. turn to ball" );
     }
 
-    agent->setNeckAction( new Neck_TurnToBall() );
+    agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
 }
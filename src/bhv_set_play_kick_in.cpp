@@ -37,6 +37,7 @@
 #include "bhv_chain_action.h"
 
 #include "intention_wait_after_set_play_kick.h"
+#include "pooled.h"
 
 #include <rcsc/action/basic_actions.h>
 #include <rcsc/action/body_go_to_point.h>
@@ -123,7 +124,7 @@ Bhv_SetPlayKickIn::doKick( PlayerAgent * agent )
     //
     if ( Bhv_ChainAction().execute( agent ) )
     {
-        agent->setIntention( new IntentionWaitAfterSetPlayKick() );
+        agent->setIntention( new Pooled< IntentionWaitAfterSetPlayKick >() );
         agent->debugClient().addMessage( "KickIn:Chain" );
         return;
     }
@@ -200,7 +201,7 @@ Bhv_SetPlayKickIn::doKick( PlayerAgent * agent )
             Body_KickOneStep( target_point,
                               ball_speed
                               ).execute( agent );
-            agent->setNeckAction( new Neck_ScanField() );
+            agent->setNeckAction( new Pooled< Neck_ScanField >() );
             return;
         }
     }
@@ -220,7 +221,7 @@ Bhv_SetPlayKickIn::doKick( PlayerAgent * agent )
                       __FILE__":  clear. turn to ball" );
 
         Body_TurnToBall().execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return;
     }
 
@@ -235,7 +236,7 @@ Bhv_SetPlayKickIn::doKick( PlayerAgent * agent )
         dlog.addText( Logger::TEAM,
                       __FILE__": advance(1)" );
         Body_AdvanceBall().execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return;
     }
 
@@ -260,7 +261,7 @@ Bhv_SetPlayKickIn::doKick( PlayerAgent * agent )
         Body_KickOneStep( target_point,
                           ServerParam::i().ballSpeedMax()
                           ).execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
     }
 }
 
@@ -291,7 +292,7 @@ Bhv_SetPlayKickIn::doKickWait( PlayerAgent * agent )
                       __FILE__": (doKickWait) delaying" );
 
         Body_TurnToPoint( Vector2D( 0.0, 0.0 ) ).execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -302,7 +303,7 @@ Bhv_SetPlayKickIn::doKickWait( PlayerAgent * agent )
                       __FILE__": (doKickWait) no teammate" );
 
         Body_TurnToPoint( Vector2D( 0.0, 0.0 ) ).execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -313,7 +314,7 @@ Bhv_SetPlayKickIn::doKickWait( PlayerAgent * agent )
                       __FILE__": (doKickWait) wait teammates" );
 
         Body_TurnToBall().execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -331,7 +332,7 @@ Bhv_SetPlayKickIn::doKickWait( PlayerAgent * agent )
          || wm.self().stamina() < ServerParam::i().staminaMax() * 0.9 )
     {
         Body_TurnToBall().execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
 
         agent->debugClient().addMessage( "KickIn:Wait%d", wm.setplayCount() );
         dlog.addText( Logger::TEAM,
@@ -427,22 +428,22 @@ Bhv_SetPlayKickIn::doMove( PlayerAgent * agent )
         if ( ! wm.self().staminaModel().capacityIsEmpty() )
         {
             agent->debugClient().addMessage( "Sayw" );
-            agent->addSayMessage( new WaitRequestMessage() );
+            agent->addSayMessage( new Pooled< WaitRequestMessage >() );
         }
     }
 
     if ( kicker_ball_dist > 3.0 )
     {
-        agent->setViewAction( new View_Wide() );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setViewAction( new Pooled< View_Wide >() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
     }
     else if ( wm.ball().distFromSelf() > 10.0
               || kicker_ball_dist > 1.0 )
     {
-        agent->setNeckAction( new Neck_TurnToBallOrScan() );
+        agent->setNeckAction( new Pooled< Neck_TurnToBallOrScan >() );
     }
     else
     {
-        agent->setNeckAction( new Neck_TurnToBall() );
+        agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
     }
 }
@@ -35,6 +35,7 @@
 #include "bhv_go_to_static_ball.h"
 #include "bhv_set_play.h"
 #include "bhv_prepare_set_play_kick.h"
+#include "pooled.h"
 
 #include <rcsc/action/body_smart_kick.h>
 
@@ -173,7 +174,7 @@ Bhv_SetPlayKickOff::doKick( PlayerAgent * agent )
                     ball_speed,
                     ball_speed * 0.96,
                     1 ).execute( agent );
-    agent->setNeckAction( new Neck_ScanField() );
+    agent->setNeckAction( new Pooled< Neck_ScanField >() );
 }
 
 /*-------------------------------------------------------------------*/
@@ -203,7 +204,7 @@ Bhv_SetPlayKickOff::doKickWait( PlayerAgent * agent )
                       __FILE__": (doKickWait) delaying" );
 
         Body_TurnToAngle( 180.0 ).execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -214,7 +215,7 @@ Bhv_SetPlayKickOff::doKickWait( PlayerAgent * agent )
                       __FILE__": (doKickWait) turn" );
 
         Body_TurnToAngle( 180.0 ).execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -225,7 +226,7 @@ Bhv_SetPlayKickOff::doKickWait( PlayerAgent * agent )
                       __FILE__": (doKickWait) no teammate" );
 
         Body_TurnToAngle( 180.0 ).execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -236,7 +237,7 @@ Bhv_SetPlayKickOff::doKickWait( PlayerAgent * agent )
                       __FILE__": (doKickWait) wait..." );
 
         Body_TurnToAngle( 180.0 ).execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -249,7 +250,7 @@ Bhv_SetPlayKickOff::doKickWait( PlayerAgent * agent )
 
         //Body_TurnToBall().execute( agent );
         Body_TurnToAngle( 180.0 ).execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -279,7 +280,7 @@ Bhv_SetPlayKickOff::doMove( PlayerAgent * agent )
     {
         Body_TurnToBall().execute( agent );
     }
-    agent->setNeckAction( new Neck_ScanField() );
+    agent->setNeckAction( new Pooled< Neck_ScanField >() );
 
     agent->debugClient().setTarget( target_point );
 }
@@ -33,6 +33,7 @@
 #include "strategy.h"
 
 #include "bhv_set_play.h"
+#include "pooled.h"
 
 #include <rcsc/action/body_intercept.h>
 
@@ -141,7 +142,7 @@ Bhv_TheirGoalKickMove::execute( PlayerAgent * agent )
         // already there
         Body_TurnToBall().execute( agent );
     }
-    agent->setNeckAction( new Neck_ScanField() );
+    agent->setNeckAction( new Pooled< Neck_ScanField >() );
     return true;
 }
 
@@ -189,7 +190,7 @@ Bhv_TheirGoalKickMove::doNormal( PlayerAgent * agent )
         // already there
         Body_TurnToBall().execute( agent );
     }
-    agent->setNeckAction( new Neck_TurnToBallOrScan() );
+    agent->setNeckAction( new Pooled< Neck_TurnToBallOrScan >() );
 }
 
 /*-------------------------------------------------------------------*/
@@ -240,6 +241,6 @@ Bhv_TheirGoalKickMove::doChaseBall( PlayerAgent * agent )
     // can chase !!
     agent->debugClient().addMessage( "GKickGetBall" );
     Body_Intercept().execute( agent );
-    agent->setNeckAction( new Neck_TurnToBallOrScan() );
+    agent->setNeckAction( new Pooled< Neck_TurnToBallOrScan >() );
     return true;
 }
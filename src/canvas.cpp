@@ -0,0 +1,166 @@
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "canvas.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+// 3x5 glyphs, one row of 3 bits per entry, most significant bit left
+struct Glyph {
+  char c;
+  unsigned char rows[5];
+};
+
+const Glyph FONT[] = {
+  {'0', {7, 5, 5, 5, 7}}, {'1', {2, 6, 2, 2, 7}}, {'2', {7, 1, 7, 4, 7}},
+  {'3', {7, 1, 7, 1, 7}}, {'4', {5, 5, 7, 1, 1}}, {'5', {7, 4, 7, 1, 7}},
+  {'6', {7, 4, 7, 5, 7}}, {'7', {7, 1, 1, 1, 1}}, {'8', {7, 5, 7, 5, 7}},
+  {'9', {7, 5, 7, 1, 7}}, {':', {0, 2, 0, 2, 0}}, {'-', {0, 0, 7, 0, 0}},
+  {' ', {0, 0, 0, 0, 0}}
+};
+
+const Glyph* findGlyph(char c) {
+  for (size_t i = 0; i < sizeof(FONT) / sizeof(FONT[0]); ++i) {
+    if (FONT[i].c == c) {
+      return &FONT[i];
+    }
+  }
+  return NULL;
+}
+
+}
+
+Canvas::Canvas(int width, int height) :
+  w(width), h(height), pixels(3 * width * height, 0)
+{
+}
+
+void Canvas::copy(const Canvas& other) {
+  std::memcpy(&pixels[0], other.data(), pixels.size());
+}
+
+void Canvas::fill(Color c) {
+  for (int y = 0; y < h; ++y) {
+    for (int x = 0; x < w; ++x) {
+      put(x, y, c);
+    }
+  }
+}
+
+bool Canvas::clip(double x0, double y0, double x1, double y1,
+                  int& px0, int& py0, int& px1, int& py1) const {
+  px0 = std::max(0, (int) std::floor(std::min(x0, x1)));
+  py0 = std::max(0, (int) std::floor(std::min(y0, y1)));
+  px1 = std::min(w - 1, (int) std::ceil(std::max(x0, x1)));
+  py1 = std::min(h - 1, (int) std::ceil(std::max(y0, y1)));
+  return px0 <= px1 && py0 <= py1;
+}
+
+void Canvas::fillRect(double x0, double y0, double x1, double y1, Color c) {
+  int px0, py0, px1, py1;
+  if (!clip(x0, y0, x1 - 1, y1 - 1, px0, py0, px1, py1)) {
+    return;
+  }
+  for (int y = py0; y <= py1; ++y) {
+    for (int x = px0; x <= px1; ++x) {
+      put(x, y, c);
+    }
+  }
+}
+
+void Canvas::fillCircle(double cx, double cy, double r, Color c) {
+  int px0, py0, px1, py1;
+  if (!clip(cx - r, cy - r, cx + r, cy + r, px0, py0, px1, py1)) {
+    return;
+  }
+  // Pixel centers inside the circle
+  const double r2 = r * r;
+  for (int y = py0; y <= py1; ++y) {
+    const double dy = y + 0.5 - cy;
+    for (int x = px0; x <= px1; ++x) {
+      const double dx = x + 0.5 - cx;
+      if (dx * dx + dy * dy <= r2) {
+        put(x, y, c);
+      }
+    }
+  }
+}
+
+void Canvas::drawCircle(double cx, double cy, double r, double thickness,
+                        Color c) {
+  const double outer = r + thickness / 2;
+  const double inner = std::max(0.0, r - thickness / 2);
+  int px0, py0, px1, py1;
+  if (!clip(cx - outer, cy - outer, cx + outer, cy + outer,
+            px0, py0, px1, py1)) {
+    return;
+  }
+  const double outer2 = outer * outer;
+  const double inner2 = inner * inner;
+  for (int y = py0; y <= py1; ++y) {
+    const double dy = y + 0.5 - cy;
+    for (int x = px0; x <= px1; ++x) {
+      const double dx = x + 0.5 - cx;
+      const double d2 = dx * dx + dy * dy;
+      if (d2 <= outer2 && d2 >= inner2) {
+        put(x, y, c);
+      }
+    }
+  }
+}
+
+void Canvas::drawLine(double x0, double y0, double x1, double y1,
+                      double thickness, Color c) {
+  const double half = std::max(0.5, thickness / 2);
+  int px0, py0, px1, py1;
+  if (!clip(std::min(x0, x1) - half, std::min(y0, y1) - half,
+            std::max(x0, x1) + half, std::max(y0, y1) + half,
+            px0, py0, px1, py1)) {
+    return;
+  }
+  // Pixel centers within half of the segment
+  const double vx = x1 - x0;
+  const double vy = y1 - y0;
+  const double len2 = vx * vx + vy * vy;
+  const double half2 = half * half;
+  for (int y = py0; y <= py1; ++y) {
+    for (int x = px0; x <= px1; ++x) {
+      const double dx = x + 0.5 - x0;
+      const double dy = y + 0.5 - y0;
+      double t = len2 > 0 ? (dx * vx + dy * vy) / len2 : 0;
+      t = std::max(0.0, std::min(1.0, t));
+      const double ex = dx - t * vx;
+      const double ey = dy - t * vy;
+      if (ex * ex + ey * ey <= half2) {
+        put(x, y, c);
+      }
+    }
+  }
+}
+
+int Canvas::textWidth(const std::string& text, int scale) {
+  return text.empty() ? 0 : (4 * text.size() - 1) * scale;
+}
+
+int Canvas::drawText(int x, int y, const std::string& text, int scale,
+                     Color c) {
+  for (size_t i = 0; i < text.size(); ++i) {
+    const Glyph* glyph = findGlyph(text[i]);
+    if (glyph != NULL) {
+      for (int row = 0; row < 5; ++row) {
+        for (int col = 0; col < 3; ++col) {
+          if (glyph->rows[row] & (4 >> col)) {
+            const int gx = x + (4 * i + col) * scale;
+            const int gy = y + row * scale;
+            fillRect(gx, gy, gx + scale, gy + scale, c);
+          }
+        }
+      }
+    }
+  }
+  return textWidth(text, scale);
+}
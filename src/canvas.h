@@ -0,0 +1,58 @@
+// -*-c++-*-
+
+#ifndef CANVAS_H
+#define CANVAS_H
+
+#include <string>
+#include <vector>
+
+/**
+ * Software rasterizer drawing into an RGB24 frame buffer, so that games
+ * can be rendered without a display or a GPU. Coordinates are in pixels,
+ * from the top left corner; shapes are clipped to the canvas.
+ */
+class Canvas {
+public:
+  struct Color {
+    unsigned char r, g, b;
+  };
+
+  Canvas(int width, int height);
+
+  inline int width() const { return w; }
+  inline int height() const { return h; }
+  // Rows of width() RGB triplets, top to bottom
+  inline const unsigned char* data() const { return &pixels[0]; }
+  inline size_t size() const { return pixels.size(); }
+
+  // Copies the pixels of a canvas of the same size
+  void copy(const Canvas& other);
+
+  void fill(Color c);
+  void fillRect(double x0, double y0, double x1, double y1, Color c);
+  void fillCircle(double cx, double cy, double r, Color c);
+  // Ring of the given thickness centered on the circle of radius r
+  void drawCircle(double cx, double cy, double r, double thickness, Color c);
+  void drawLine(double x0, double y0, double x1, double y1,
+                double thickness, Color c);
+  // Digits, ':', '-' and ' ' in a 3x5 pixel font magnified by scale;
+  // (x, y) is the top left corner. Returns the width drawn.
+  int drawText(int x, int y, const std::string& text, int scale, Color c);
+  static int textWidth(const std::string& text, int scale);
+
+private:
+  inline void put(int x, int y, Color c) {
+    unsigned char* p = &pixels[3 * (y * w + x)];
+    p[0] = c.r;
+    p[1] = c.g;
+    p[2] = c.b;
+  }
+  // Pixel bounds of a shape, clipped; false if nothing is visible
+  bool clip(double x0, double y0, double x1, double y1,
+            int& px0, int& py0, int& px1, int& py1) const;
+
+  int w, h;
+  std::vector<unsigned char> pixels;
+};
+
+#endif // CANVAS_H
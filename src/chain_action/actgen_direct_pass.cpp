@@ -30,6 +30,7 @@
 
 #include "pass.h"
 #include "simple_pass_checker.h"
+#include "ball_travel_table.h"
 
 #include "predict_state.h"
 #include "action_state_pair.h"
@@ -293,9 +294,7 @@ ActGen_DirectPass::generate( std::vector< ActionStatePair > * result,
         const unsigned long kick_step = 2;
 
         const unsigned long spend_time
-            = calc_length_geom_series( ball_speed,
-                                       dist,
-                                       ServerParam::i().ballDecay() )
+            = BallTravelTable::i().reachLength( ball_speed, dist )
             + kick_step;
 
         PredictState::ConstPtr result_state( new PredictState( state,
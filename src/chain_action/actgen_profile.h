@@ -0,0 +1,74 @@
+// -*-c++-*-
+
+/*
+ *Copyright:
+
+ Copyright (C) Hiroki SHIMORA, Hidehisa AKIYAMA
+
+ This code is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 3, or (at your option)
+ any later version.
+
+ This code is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this code; see the file COPYING.  If not, write to
+ the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+
+ *EndCopyright:
+ */
+
+/////////////////////////////////////////////////////////////////////
+
+#ifndef ACTGEN_PROFILE_H
+#define ACTGEN_PROFILE_H
+
+#include "action_generator.h"
+#include "action_chain_profiler.h"
+#include "action_state_pair.h"
+
+#include <rcsc/timer.h>
+
+#include <string>
+#include <vector>
+
+/*!
+  \class ActGen_Profile
+  \brief decorator that records the cost of the wrapped generator
+  in ActionChainProfiler.
+ */
+class ActGen_Profile
+    : public ActionGenerator {
+private:
+    const ActionGenerator::ConstPtr M_generator;
+    const int M_slot;
+
+public:
+    ActGen_Profile( const std::string & name,
+                    const ActionGenerator * generator )
+        : M_generator( generator )
+        , M_slot( ActionChainProfiler::instance().registerGenerator( name ) )
+      { }
+
+    void generate( std::vector< ActionStatePair > * result,
+                   const PredictState & state,
+                   const rcsc::WorldModel & current_wm,
+                   const std::vector< ActionStatePair > & path ) const
+      {
+          const size_t first = result->size();
+          const rcsc::Timer timer;
+
+          M_generator->generate( result, state, current_wm, path );
+
+          ActionChainProfiler::instance().addGenerate( M_slot,
+                                                       first,
+                                                       result->size(),
+                                                       timer.elapsedReal() * 1000.0 );
+      }
+};
+
+#endif
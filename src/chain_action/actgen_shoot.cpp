@@ -67,8 +67,7 @@ ActGen_Shoot::generate( std::vector< ActionStatePair > * result,
     }
 
 
-    AbstractPlayerCont opponents
-        = state.getPlayerCont( new OpponentOrUnknownPlayerPredicate( wm ) );
+    const AbstractPlayerCont & opponents = state.opponentsOrUnknown();
 
     if ( ! FieldAnalyzer::can_shoot_from( holder->unum() == wm.self().unum(),
                                           holder->pos(),
@@ -29,6 +29,7 @@
 #include "action_chain_graph.h"
 
 #include "hold_ball.h"
+#include "action_chain_profiler.h"
 
 #include <rcsc/player/player_agent.h>
 #include <rcsc/common/server_param.h>
@@ -121,6 +122,7 @@ ActionChainGraph::ActionChainGraph( const FieldEvaluator::ConstPtr & evaluator,
       M_action_generator( generator ),
       M_chain_count( 0 ),
       M_best_chain_count( 0 ),
+      M_best_profile_slot( -1 ),
       M_max_chain_length( max_chain_length ),
       M_max_evaluate_limit( max_evaluate_limit ),
       M_result(),
@@ -141,13 +143,12 @@ ActionChainGraph::calculateResult( const WorldModel & wm )
 {
     debugPrintCurrentState( wm );
 
-#if (defined DEBUG_PROFILE) || (defined ACTION_CHAIN_LOAD_DEBUG)
     Timer timer;
-#endif
 
     unsigned long n_evaluated = 0;
     M_chain_count = 0;
     M_best_chain_count = 0;
+    M_best_profile_slot = -1;
 
     //
     // best first
@@ -174,8 +175,13 @@ ActionChainGraph::calculateResult( const WorldModel & wm )
                      M_result,
                      M_best_evaluation );
 
-#if (defined DEBUG_PROFILE) || (defined ACTION_CHAIN_LOAD_DEBUG)
     const double msec = timer.elapsedReal();
+
+    ActionChainProfiler::instance().addPlan( M_best_profile_slot,
+                                             static_cast< int >( M_result.size() ),
+                                             msec * 1000.0 );
+
+#if (defined DEBUG_PROFILE) || (defined ACTION_CHAIN_LOAD_DEBUG)
 #ifdef DEBUG_PROFILE
     dlog.addText( Logger::ACTION_CHAIN,
                   __FILE__": PROFILE size=%d elapsed %f [ms]",
@@ -416,9 +422,13 @@ ActionChainGraph::calculateResultBestFirstSearch( const WorldModel & wm,
     //
     // check current state
     //
+    ActionChainProfiler & profiler = ActionChainProfiler::instance();
+
     const PredictState current_state( wm );
     const std::vector< ActionStatePair > empty_path;
+    const Timer eval_timer;
     const double current_evaluation = (*M_evaluator)( current_state, empty_path );
+    profiler.addEvaluate( -1, eval_timer.elapsedReal() * 1000.0 );
     ++M_chain_count;
     ++(*n_evaluated);
 #ifdef ACTION_CHAIN_DEBUG
@@ -474,6 +484,7 @@ ActionChainGraph::calculateResultBestFirstSearch( const WorldModel & wm,
              && ( series.empty()
                   || ! ( *( series.rbegin() ) ).action().isFinalAction() ) )
         {
+            profiler.beginGenerate();
             M_action_generator->generate( &candidates, *state, wm, series );
 #ifdef ACTION_CHAIN_DEBUG
             dlog.addText( Logger::ACTION_CHAIN,
@@ -496,7 +507,10 @@ ActionChainGraph::calculateResultBestFirstSearch( const WorldModel & wm,
             std::vector< ActionStatePair > candidate_series = series;
             candidate_series.push_back( *it );
 
+            const int slot = profiler.candidateSlot( it - candidates.begin() );
+            const Timer timer;
             double ev = (*M_evaluator)( (*it).state(), candidate_series );
+            profiler.addEvaluate( slot, timer.elapsedReal() * 1000.0 );
             ++(*n_evaluated);
 #ifdef ACTION_CHAIN_DEBUG
             write_chain_log( wm, M_chain_count, candidate_series, ev );
@@ -513,6 +527,7 @@ ActionChainGraph::calculateResultBestFirstSearch( const WorldModel & wm,
                               "<<<< update best result." );
 #endif
                 M_best_chain_count = M_chain_count;
+                M_best_profile_slot = slot;
                 M_best_evaluation = ev;
                 M_result = candidate_series;
             }
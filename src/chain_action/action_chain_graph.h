@@ -67,6 +67,7 @@ private:
 
     int M_chain_count;
     int M_best_chain_count;
+    int M_best_profile_slot; //!< profiler slot of the last action in the best chain
 
     unsigned long M_max_chain_length;
     long M_max_evaluate_limit;
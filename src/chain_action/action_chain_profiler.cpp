@@ -0,0 +1,259 @@
+// -*-c++-*-
+
+/*!
+  \file action_chain_profiler.cpp
+  \brief lightweight profiling counters of the action chain planner Source File
+*/
+
+/*
+ *Copyright:
+
+ Copyright (C) Hiroki SHIMORA, Hidehisa AKIYAMA
+
+ This code is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 3, or (at your option)
+ any later version.
+
+ This code is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this code; see the file COPYING.  If not, write to
+ the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+
+ *EndCopyright:
+ */
+
+/////////////////////////////////////////////////////////////////////
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "action_chain_profiler.h"
+
+#include <algorithm>
+#include <iostream>
+#include <cstdio>
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+ActionChainProfiler::Counter::Counter( const std::string & name )
+    : name_( name )
+{
+    clear();
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+void
+ActionChainProfiler::Counter::clear()
+{
+    calls_ = 0;
+    generated_ = 0;
+    evaluated_ = 0;
+    best_count_ = 0;
+    best_depth_sum_ = 0;
+    best_depth_max_ = 0;
+    generate_usec_ = 0.0;
+    evaluate_usec_ = 0.0;
+    total_usec_ = 0.0;
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+ActionChainProfiler::ActionChainProfiler()
+    : M_total( "total" ),
+      M_episode( 0 )
+{
+    M_generators.reserve( 16 );
+    M_candidate_slots.reserve( 256 );
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+ActionChainProfiler &
+ActionChainProfiler::instance()
+{
+#ifdef __APPLE__
+    static ActionChainProfiler s_instance;
+#else
+    static thread_local ActionChainProfiler s_instance;
+#endif
+    return s_instance;
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+const
+ActionChainProfiler &
+ActionChainProfiler::i()
+{
+    return instance();
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+int
+ActionChainProfiler::registerGenerator( const std::string & name )
+{
+    for ( size_t i = 0; i < M_generators.size(); ++i )
+    {
+        if ( M_generators[i].name_ == name )
+        {
+            return static_cast< int >( i );
+        }
+    }
+
+    M_generators.push_back( Counter( name ) );
+    return static_cast< int >( M_generators.size() ) - 1;
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+void
+ActionChainProfiler::startEpisode()
+{
+    ++M_episode;
+
+    for ( std::vector< Counter >::iterator it = M_generators.begin();
+          it != M_generators.end();
+          ++it )
+    {
+        it->clear();
+    }
+
+    M_total.clear();
+    M_candidate_slots.clear();
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+void
+ActionChainProfiler::addGenerate( const int slot,
+                                  const size_t first,
+                                  const size_t last,
+                                  const double & usec )
+{
+    if ( slot < 0
+         || static_cast< int >( M_generators.size() ) <= slot )
+    {
+        return;
+    }
+
+    Counter & c = M_generators[slot];
+    ++c.calls_;
+    c.generated_ += last - first;
+    c.generate_usec_ += usec;
+
+    ++M_total.calls_;
+    M_total.generated_ += last - first;
+    M_total.generate_usec_ += usec;
+
+    if ( M_candidate_slots.size() < last )
+    {
+        // candidates of the generators without profiling have no slot.
+        M_candidate_slots.resize( last, -1 );
+    }
+
+    std::fill( M_candidate_slots.begin() + first,
+               M_candidate_slots.begin() + last,
+               slot );
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+void
+ActionChainProfiler::addEvaluate( const int slot,
+                                  const double & usec )
+{
+    ++M_total.evaluated_;
+    M_total.evaluate_usec_ += usec;
+
+    if ( slot < 0
+         || static_cast< int >( M_generators.size() ) <= slot )
+    {
+        return;
+    }
+
+    Counter & c = M_generators[slot];
+    ++c.evaluated_;
+    c.evaluate_usec_ += usec;
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+void
+ActionChainProfiler::addPlan( const int best_slot,
+                              const int best_depth,
+                              const double & usec )
+{
+    // generate calls are counted by addGenerate().
+    // the total counter uses best_count_ as the number of plans.
+    ++M_total.best_count_;
+    M_total.best_depth_sum_ += best_depth;
+    M_total.best_depth_max_ = std::max( M_total.best_depth_max_, best_depth );
+    M_total.total_usec_ += usec;
+
+    if ( best_slot < 0
+         || static_cast< int >( M_generators.size() ) <= best_slot )
+    {
+        return;
+    }
+
+    Counter & c = M_generators[best_slot];
+    ++c.best_count_;
+    c.best_depth_sum_ += best_depth;
+    c.best_depth_max_ = std::max( c.best_depth_max_, best_depth );
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+std::ostream &
+ActionChainProfiler::print( std::ostream & os ) const
+{
+    char buf[256];
+
+    os << "# episode " << M_episode << '\n'
+       << "# name calls generated evaluated best best_depth_sum best_depth_max"
+       << " generate_usec evaluate_usec total_usec\n";
+
+    for ( size_t i = 0; i <= M_generators.size(); ++i )
+    {
+        const Counter & c = ( i < M_generators.size() ? M_generators[i] : M_total );
+        snprintf( buf, sizeof( buf ),
+                  "%s %lu %lu %lu %lu %lu %d %.0f %.0f %.0f\n",
+                  c.name_.c_str(),
+                  c.calls_, c.generated_, c.evaluated_,
+                  c.best_count_, c.best_depth_sum_, c.best_depth_max_,
+                  c.generate_usec_, c.evaluate_usec_, c.total_usec_ );
+        os << buf;
+    }
+
+    return os;
+}
@@ -0,0 +1,204 @@
+// -*-c++-*-
+
+/*!
+  \file action_chain_profiler.h
+  \brief lightweight profiling counters of the action chain planner Header File
+*/
+
+/*
+ *Copyright:
+
+ Copyright (C) Hiroki SHIMORA, Hidehisa AKIYAMA
+
+ This code is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 3, or (at your option)
+ any later version.
+
+ This code is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this code; see the file COPYING.  If not, write to
+ the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+
+ *EndCopyright:
+ */
+
+/////////////////////////////////////////////////////////////////////
+
+#ifndef ACTION_CHAIN_PROFILER_H
+#define ACTION_CHAIN_PROFILER_H
+
+#include <string>
+#include <vector>
+#include <iosfwd>
+
+/*!
+  \class ActionChainProfiler
+  \brief always-on counters of the action chain planner.
+
+  Each profiled generator (see ActGen_Profile) owns one slot. ActionChainGraph
+  reports the candidates evaluated for each slot and the best chain of each
+  plan. The counters are accumulated until startEpisode() is called.
+ */
+class ActionChainProfiler {
+public:
+
+    /*!
+      \struct Counter
+      \brief accumulated values of one generator or of the whole planner
+     */
+    struct Counter {
+        std::string name_; //!< generator name
+        unsigned long calls_; //!< the number of generate calls (or plans)
+        unsigned long generated_; //!< the number of generated candidates
+        unsigned long evaluated_; //!< the number of evaluated candidates
+        unsigned long best_count_; //!< the number of plans whose best chain ends with this generator
+        unsigned long best_depth_sum_; //!< sum of the best chain length
+        int best_depth_max_; //!< maximum best chain length
+        double generate_usec_; //!< time spent in generate [usec]
+        double evaluate_usec_; //!< time spent in evaluation [usec]
+        double total_usec_; //!< wall time of the planner (total counter only) [usec]
+
+        explicit
+        Counter( const std::string & name = std::string() );
+
+        void clear();
+    };
+
+private:
+
+    //! per generator counters. index is the slot id.
+    std::vector< Counter > M_generators;
+
+    //! counter of the whole planner
+    Counter M_total;
+
+    //! the number of started episodes
+    unsigned long M_episode;
+
+    //! slot id of each candidate generated in the current generate call
+    std::vector< int > M_candidate_slots;
+
+private:
+    /*!
+      \brief private constructor to inhibit instantiation expect singleton
+     */
+    ActionChainProfiler();
+
+    /*!
+      \brief private constructor to inhibit instantiation expect singleton
+     */
+    ActionChainProfiler( const ActionChainProfiler & );
+
+    /*!
+      \brief private operator=
+     */
+    const ActionChainProfiler & operator=( const ActionChainProfiler & );
+
+public:
+    static
+    ActionChainProfiler & instance();
+
+    static
+    const
+    ActionChainProfiler & i();
+
+    /*!
+      \brief get the slot of the generator. a new slot is created for an unknown name.
+      \param name generator name
+      \return slot id
+     */
+    int registerGenerator( const std::string & name );
+
+    /*!
+      \brief reset all counters. registered slots are kept.
+     */
+    void startEpisode();
+
+    /*!
+      \brief called by the planner before each generate call of the root generator
+     */
+    void beginGenerate()
+      {
+          M_candidate_slots.clear();
+      }
+
+    /*!
+      \brief record one generate call
+      \param slot slot id
+      \param first index of the first candidate generated by this call
+      \param last index of the next to the last candidate
+      \param usec elapsed time
+     */
+    void addGenerate( const int slot,
+                      const size_t first,
+                      const size_t last,
+                      const double & usec );
+
+    /*!
+      \brief get the slot of the candidate generated in the last generate call
+      \param index index in the candidate container
+      \return slot id. -1 if not profiled
+     */
+    int candidateSlot( const size_t index ) const
+      {
+          return ( index < M_candidate_slots.size()
+                   ? M_candidate_slots[index]
+                   : -1 );
+      }
+
+    /*!
+      \brief record one evaluation
+      \param slot slot id. -1 for the candidates without profiling and the current state
+      \param usec elapsed time
+     */
+    void addEvaluate( const int slot,
+                      const double & usec );
+
+    /*!
+      \brief record one planning result
+      \param best_slot slot of the last action in the best chain (or -1)
+      \param best_depth length of the best chain
+      \param usec elapsed time of the whole planning
+     */
+    void addPlan( const int best_slot,
+                  const int best_depth,
+                  const double & usec );
+
+    /*!
+      \brief get the number of started episodes
+     */
+    unsigned long episode() const
+      {
+          return M_episode;
+      }
+
+    /*!
+      \brief get the per generator counters
+     */
+    const std::vector< Counter > & generators() const
+      {
+          return M_generators;
+      }
+
+    /*!
+      \brief get the counter of the whole planner
+     */
+    const Counter & total() const
+      {
+          return M_total;
+      }
+
+    /*!
+      \brief put all counters to the stream
+      \param os reference to the output stream
+      \return reference to the output stream
+     */
+    std::ostream & print( std::ostream & os ) const;
+};
+
+#endif
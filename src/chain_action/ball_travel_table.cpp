@@ -0,0 +1,235 @@
+// -*-c++-*-
+
+/*!
+  \file ball_travel_table.cpp
+  \brief precomputed ball travel table Source File
+*/
+
+/*
+ *Copyright:
+
+ Copyright (C) Hiroki SHIMORA, Hidehisa AKIYAMA
+
+ This code is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 3, or (at your option)
+ any later version.
+
+ This code is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this code; see the file COPYING.  If not, write to
+ the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+
+ *EndCopyright:
+ */
+
+/////////////////////////////////////////////////////////////////////
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "ball_travel_table.h"
+
+#include <rcsc/common/server_param.h>
+#include <rcsc/soccer_math.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace rcsc;
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+BallTravelTable::BallTravelTable()
+    : M_decay( -1.0 )
+{
+    std::fill( M_decay_pow, M_decay_pow + MAX_STEP + 1, 0.0 );
+    std::fill( M_travel_rate, M_travel_rate + MAX_STEP + 1, 0.0 );
+    std::fill( M_first_speed_rate, M_first_speed_rate + MAX_STEP + 1, 0.0 );
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+BallTravelTable &
+BallTravelTable::instance()
+{
+#ifdef __APPLE__
+    static BallTravelTable s_instance;
+#else
+    static thread_local BallTravelTable s_instance;
+#endif
+    return s_instance;
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+const
+BallTravelTable &
+BallTravelTable::i()
+{
+    return instance();
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+bool
+BallTravelTable::createTables()
+{
+    const double decay = ServerParam::i().ballDecay();
+
+    if ( decay <= 0.0 || 1.0 <= decay )
+    {
+        M_decay = -1.0;
+        return false;
+    }
+
+    if ( std::fabs( M_decay - decay ) < 1.0e-10 )
+    {
+        // already created for the same parameter
+        return true;
+    }
+
+    M_decay = decay;
+
+    M_decay_pow[0] = 1.0;
+    M_travel_rate[0] = 0.0;
+    M_first_speed_rate[0] = 0.0;
+
+    for ( int n = 1; n <= MAX_STEP; ++n )
+    {
+        M_decay_pow[n] = M_decay_pow[n - 1] * decay;
+        M_travel_rate[n] = ( 1.0 - M_decay_pow[n] ) / ( 1.0 - decay );
+        M_first_speed_rate[n] = 1.0 / M_travel_rate[n];
+    }
+
+    return true;
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+double
+BallTravelTable::decayPow( const int step ) const
+{
+    if ( M_decay < 0.0
+         || step < 0
+         || MAX_STEP < step )
+    {
+        return std::pow( ServerParam::i().ballDecay(), step );
+    }
+
+    return M_decay_pow[step];
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+double
+BallTravelTable::travelDistance( const double & first_speed,
+                                 const int step ) const
+{
+    if ( M_decay < 0.0
+         || step < 0
+         || MAX_STEP < step )
+    {
+        return calc_sum_geom_series( first_speed, ServerParam::i().ballDecay(), step );
+    }
+
+    return first_speed * M_travel_rate[step];
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+double
+BallTravelTable::firstSpeed( const double & dist,
+                             const int step ) const
+{
+    if ( M_decay < 0.0
+         || step < 1
+         || MAX_STEP < step )
+    {
+        return calc_first_term_geom_series( dist, ServerParam::i().ballDecay(), step );
+    }
+
+    return dist * M_first_speed_rate[step];
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+double
+BallTravelTable::reachLength( const double & first_speed,
+                              const double & dist ) const
+{
+    if ( M_decay < 0.0 )
+    {
+        return calc_length_geom_series( first_speed, dist, ServerParam::i().ballDecay() );
+    }
+
+    // same error handling as calc_length_geom_series()
+    if ( first_speed <= 1.0e-10 || dist < 0.0 )
+    {
+        return -1.0;
+    }
+
+    if ( dist <= 1.0e-10 )
+    {
+        return 0.0;
+    }
+
+    if ( 1.0 + dist * ( M_decay - 1.0 ) / first_speed <= 1.0e-10 )
+    {
+        return -1.0;
+    }
+
+    const double rate = dist / first_speed;
+
+    if ( M_travel_rate[MAX_STEP] <= rate )
+    {
+        return calc_length_geom_series( first_speed, dist, M_decay );
+    }
+
+    // M_travel_rate[n] <= rate < M_travel_rate[n + 1]
+    const int n = static_cast< int >( std::upper_bound( M_travel_rate,
+                                                        M_travel_rate + MAX_STEP + 1,
+                                                        rate )
+                                      - M_travel_rate ) - 1;
+
+    return n + ( rate - M_travel_rate[n] ) / ( M_travel_rate[n + 1] - M_travel_rate[n] );
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+int
+BallTravelTable::reachStep( const double & first_speed,
+                            const double & dist ) const
+{
+    const double len = reachLength( first_speed, dist );
+
+    if ( len < 0.0 )
+    {
+        return -1;
+    }
+
+    return static_cast< int >( std::ceil( len ) );
+}
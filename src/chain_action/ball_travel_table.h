@@ -0,0 +1,140 @@
+// -*-c++-*-
+
+/*!
+  \file ball_travel_table.h
+  \brief precomputed ball travel table Header File
+*/
+
+/*
+ *Copyright:
+
+ Copyright (C) Hiroki SHIMORA, Hidehisa AKIYAMA
+
+ This code is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 3, or (at your option)
+ any later version.
+
+ This code is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this code; see the file COPYING.  If not, write to
+ the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+
+ *EndCopyright:
+ */
+
+/////////////////////////////////////////////////////////////////////
+
+#ifndef BALL_TRAVEL_TABLE_H
+#define BALL_TRAVEL_TABLE_H
+
+/*!
+  \class BallTravelTable
+  \brief lookup table of the geometric series used by ball movement.
+
+  The table is keyed on ServerParam::ballDecay() and replaces the pow()/log()
+  calls of calc_first_term_geom_series(), calc_sum_geom_series() and
+  calc_length_geom_series() for integer steps. createTables() has to be
+  called after the server parameters are received.
+ */
+class BallTravelTable {
+public:
+    //! the number of steps stored in the table
+    static const int MAX_STEP = 100;
+
+private:
+
+    double M_decay;
+
+    //! decay^n
+    double M_decay_pow[MAX_STEP + 1];
+
+    //! (1 - decay^n) / (1 - decay): travel distance of the unit first speed
+    double M_travel_rate[MAX_STEP + 1];
+
+    //! inverse of M_travel_rate: first speed needed for the unit distance
+    double M_first_speed_rate[MAX_STEP + 1];
+
+private:
+    /*!
+      \brief private constructor to inhibit instantiation expect singleton
+     */
+    BallTravelTable();
+
+    /*!
+      \brief private constructor to inhibit instantiation expect singleton
+     */
+    BallTravelTable( const BallTravelTable & );
+
+    /*!
+      \brief private operator=
+     */
+    const BallTravelTable & operator=( const BallTravelTable & );
+
+public:
+    static
+    BallTravelTable & instance();
+
+    static
+    const
+    BallTravelTable & i();
+
+    /*!
+      \brief create tables using the current ball decay.
+      \return true if the tables are created successfully
+     */
+    bool createTables();
+
+    /*!
+      \brief get decay^step
+      \param step number of cycles
+      \return speed rate after step cycles
+     */
+    double decayPow( const int step ) const;
+
+    /*!
+      \brief get the ball travel distance
+      \param first_speed ball first speed
+      \param step number of cycles
+      \return travel distance after step cycles
+     */
+    double travelDistance( const double & first_speed,
+                           const int step ) const;
+
+    /*!
+      \brief get the first speed to reach the distance in step cycles.
+      same as calc_first_term_geom_series( dist, decay, step )
+      \param dist ball travel distance
+      \param step number of cycles
+      \return ball first speed
+     */
+    double firstSpeed( const double & dist,
+                       const int step ) const;
+
+    /*!
+      \brief get the (real valued) number of cycles to reach the distance.
+      same as calc_length_geom_series( first_speed, dist, decay ).
+      integer part is exact, fractional part is linearly interpolated.
+      \param first_speed ball first speed
+      \param dist ball travel distance
+      \return number of cycles. negative value if never reach.
+     */
+    double reachLength( const double & first_speed,
+                        const double & dist ) const;
+
+    /*!
+      \brief get the number of cycles to reach the distance.
+      \param first_speed ball first speed
+      \param dist ball travel distance
+      \return minimal step, that the ball moves dist or more. -1 if never reach.
+     */
+    int reachStep( const double & first_speed,
+                   const double & dist ) const;
+
+};
+
+#endif
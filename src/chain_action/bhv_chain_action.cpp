@@ -40,6 +40,7 @@
 #include "body_force_shoot.h"
 
 #include "neck_turn_to_receiver.h"
+#include "pooled.h"
 
 #include <rcsc/action/bhv_scan_field.h>
 #include <rcsc/action/body_clear_ball.h>
@@ -169,7 +170,7 @@ IntentionTurnTo::execute( PlayerAgent * agent )
     agent->debugClient().addMessage( "IntentionTurnToForward" );
 
     Body_TurnToPoint( M_target_point ).execute( agent );
-    agent->setNeckAction( new Neck_ScanField() );
+    agent->setNeckAction( new Pooled< Neck_ScanField >() );
 
     return true;
 }
@@ -219,7 +220,7 @@ Bhv_ChainAction::execute( PlayerAgent * agent )
     ActionChainGraph::debug_send_chain( agent, M_chain_graph.getAllChain() );
 
     const Vector2D goal_pos = SP.theirTeamGoalPos();
-    agent->setNeckAction( new Neck_TurnToReceiver( M_chain_graph ) );
+    agent->setNeckAction( new Pooled< Neck_TurnToReceiver >( M_chain_graph ) );
 
     switch ( first_action.category() ) {
     case CooperativeAction::Shoot:
@@ -228,7 +229,7 @@ Bhv_ChainAction::execute( PlayerAgent * agent )
                           __FILE__" (Bhv_ChainAction) shoot" );
             if ( Body_ForceShoot().execute( agent ) )
             {
-                agent->setNeckAction( new Neck_TurnToGoalieOrScan() );
+                agent->setNeckAction( new Pooled< Neck_TurnToGoalieOrScan >() );
                 return true;
             }
 
@@ -262,7 +263,7 @@ Bhv_ChainAction::execute( PlayerAgent * agent )
                     count_thr = -1;
                 }
                 agent->debugClient().addMessage( "ChainDribble:LookGoalie" );
-                neck = NeckAction::Ptr( new Neck_TurnToGoalieOrScan( count_thr ) );
+                neck = NeckAction::Ptr( new Pooled< Neck_TurnToGoalieOrScan >( count_thr ) );
             }
 
             if ( Bhv_NormalDribble( first_action, neck ).execute( agent ) )
@@ -289,7 +290,7 @@ Bhv_ChainAction::execute( PlayerAgent * agent )
                 dlog.addText( Logger::TEAM,
                               __FILE__" (Bhv_ChainAction) cancel hold. clear ball" );
                 Body_ClearBall().execute( agent );
-                agent->setNeckAction( new Neck_ScanField() );
+                agent->setNeckAction( new Pooled< Neck_ScanField >() );
                 return true;
             }
 
@@ -298,7 +299,7 @@ Bhv_ChainAction::execute( PlayerAgent * agent )
                           __FILE__" (Bhv_ChainAction) hold" );
 
             Body_HoldBall().execute( agent );
-            agent->setNeckAction( new Neck_ScanField() );
+            agent->setNeckAction( new Pooled< Neck_ScanField >() );
             return true;
             break;
         }
@@ -321,7 +322,7 @@ Bhv_ChainAction::execute( PlayerAgent * agent )
                                  1.0,
                                  SP.maxDashPower() ).execute( agent ) )
             {
-                agent->setNeckAction( new Neck_ScanField() );
+                agent->setNeckAction( new Pooled< Neck_ScanField >() );
                 return true;
             }
 
@@ -418,7 +419,7 @@ Bhv_ChainAction::doTurnToForward( PlayerAgent * agent )
     if ( self_next.dist2( ball_next ) < kickable2 )
     {
         Body_TurnToPoint( face_point ).execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -455,12 +456,12 @@ Bhv_ChainAction::doTurnToForward( PlayerAgent * agent )
                       __FILE__": (doTurnToForward) over kick power" );
         Body_HoldBall( true,
                        face_point ).execute( agent );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
     }
     else
     {
         agent->doKick( kick_power, kick_angle );
-        agent->setNeckAction( new Neck_ScanField() );
+        agent->setNeckAction( new Pooled< Neck_ScanField >() );
     }
 
     agent->debugClient().addMessage( "Chain:Turn:Keep" );
@@ -472,7 +473,7 @@ Bhv_ChainAction::doTurnToForward( PlayerAgent * agent )
 
     dlog.addText( Logger::TEAM,
                   __FILE__": (doTurnToFoward) register intention" );
-    agent->setIntention( new IntentionTurnTo( face_point ) );
+    agent->setIntention( new Pooled< IntentionTurnTo >( face_point ) );
 
     return true;
 }
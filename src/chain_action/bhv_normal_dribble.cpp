@@ -41,6 +41,7 @@
 
 #include "dribble.h"
 #include "short_dribble_generator.h"
+#include "pooled.h"
 
 #include <rcsc/action/basic_actions.h>
 #include <rcsc/action/neck_scan_field.h>
@@ -283,14 +284,14 @@ IntentionNormalDribble::execute( PlayerAgent * agent )
             dlog.addText( Logger::DRIBBLE,
                           __FILE__": (intention:execute) default view synch" );
             agent->debugClient().addMessage( "ViewSynch" );
-            agent->setViewAction( new View_Synch() );
+            agent->setViewAction( new Pooled< View_Synch >() );
         }
         else
         {
             dlog.addText( Logger::DRIBBLE,
                           __FILE__": (intention:execute) default view normal" );
             agent->debugClient().addMessage( "ViewNormal" );
-            agent->setViewAction( new View_Normal() );
+            agent->setViewAction( new Pooled< View_Normal >() );
         }
     }
     else
@@ -306,7 +307,7 @@ IntentionNormalDribble::execute( PlayerAgent * agent )
         dlog.addText( Logger::DRIBBLE,
                       __FILE__": (intention:execute) default turn_neck scan field" );
         agent->debugClient().addMessage( "NeckScan" );
-        agent->setNeckAction( new Neck_TurnToBallOrScan( 0 ) );
+        agent->setNeckAction( new Pooled< Neck_TurnToBallOrScan >( 0 ) );
     }
     else
     {
@@ -672,16 +673,16 @@ Bhv_NormalDribble::execute( PlayerAgent * agent )
     }
 
 
-   agent->setIntention( new IntentionNormalDribble( M_target_point,
-                                                    M_turn_step,
-                                                    M_total_step - M_turn_step - 1, // n_dash
-                                                    wm.time() ) );
+   agent->setIntention( new Pooled< IntentionNormalDribble >( M_target_point,
+                                                              M_turn_step,
+                                                              M_total_step - M_turn_step - 1, // n_dash
+                                                              wm.time() ) );
 
    if ( ! M_view_action )
    {
        if ( M_turn_step + M_dash_step >= 3 )
        {
-           agent->setViewAction( new View_Normal() );
+           agent->setViewAction( new Pooled< View_Normal >() );
        }
    }
    else
@@ -691,7 +692,7 @@ Bhv_NormalDribble::execute( PlayerAgent * agent )
 
    if ( ! M_neck_action )
    {
-       agent->setNeckAction( new Neck_ScanField() );
+       agent->setNeckAction( new Pooled< Neck_ScanField >() );
    }
    else
    {
@@ -40,6 +40,7 @@
 #include "field_analyzer.h"
 
 #include "neck_turn_to_receiver.h"
+#include "pooled.h"
 
 #include <rcsc/action/bhv_scan_field.h>
 #include <rcsc/action/body_hold_ball.h>
@@ -253,7 +254,7 @@ IntentionPassKickFindReceiver::execute( PlayerAgent * agent )
     agent->debugClient().addMessage( "IntentionTurnToReceiver%.0f",
                                      face_angle.degree() );
     Body_TurnToPoint( face_point ).execute( agent );
-    agent->setNeckAction( new Neck_TurnToPoint( face_point ) );
+    agent->setNeckAction( new Pooled< Neck_TurnToPoint >( face_point ) );
 
     return true;
 }
@@ -372,7 +373,7 @@ Bhv_PassKickFindReceiver::execute( PlayerAgent * agent )
                        pass.targetPoint(),
                        pass.targetPoint() ).execute( agent );
         doSayPass( agent, pass );
-        agent->setNeckAction( new Neck_TurnToReceiver( M_chain_graph ) );
+        agent->setNeckAction( new Pooled< Neck_TurnToReceiver >( M_chain_graph ) );
         return true;
     }
 
@@ -416,7 +417,7 @@ Bhv_PassKickFindReceiver::doPassKick( PlayerAgent * agent,
                         pass.firstBallSpeed() * 0.96,
                         3 ).execute( agent );
     }
-    agent->setNeckAction( new Neck_TurnToReceiver( M_chain_graph ) );
+    agent->setNeckAction( new Pooled< Neck_TurnToReceiver >( M_chain_graph ) );
     doSayPass( agent, pass );
 
     return true;
@@ -489,7 +490,7 @@ Bhv_PassKickFindReceiver::doCheckReceiver( PlayerAgent * agent,
     //
     // set view mode
     //
-    agent->setViewAction( new View_Synch() );
+    agent->setViewAction( new Pooled< View_Synch >() );
 
     const double next_view_half_width = agent->effector().queuedNextViewWidth().width() * 0.5;
     const double view_min = ServerParam::i().minNeckAngle() - next_view_half_width + 10.0;
@@ -640,7 +641,7 @@ Bhv_PassKickFindReceiver::doKeepBall( rcsc::PlayerAgent * agent,
                                     + ball_vel * ServerParam::i().ballDecay() );
 
     agent->doKick( kick_power, kick_angle );
-    agent->setNeckAction( new Neck_TurnToReceiver( M_chain_graph ) );
+    agent->setNeckAction( new Pooled< Neck_TurnToReceiver >( M_chain_graph ) );
 
     //
     // set turn intention
@@ -648,8 +649,8 @@ Bhv_PassKickFindReceiver::doKeepBall( rcsc::PlayerAgent * agent,
 
     dlog.addText( Logger::TEAM,
                   __FILE__": (doKeepBall) register intention" );
-    agent->setIntention( new IntentionPassKickFindReceiver( pass.targetPlayerUnum(),
-                                                            pass.targetPoint() ) );
+    agent->setIntention( new Pooled< IntentionPassKickFindReceiver >( pass.targetPlayerUnum(),
+                                                                      pass.targetPoint() ) );
 
     return true;
 }
@@ -955,7 +956,7 @@ Bhv_PassKickFindReceiver::doTurnBodyNeckToReceiver( PlayerAgent * agent,
 
     Body_TurnToPoint( best_point ).execute( agent );
     doSayPass( agent, pass );
-    agent->setNeckAction( new Neck_TurnToReceiver( M_chain_graph ) );
+    agent->setNeckAction( new Pooled< Neck_TurnToReceiver >( M_chain_graph ) );
 
     return true;
 }
@@ -995,9 +996,9 @@ Bhv_PassKickFindReceiver::doSayPass( PlayerAgent * agent,
             ball_vel = agent->effector().queuedNextBallVel();
         }
 
-        agent->addSayMessage( new PassMessage( receiver_unum,
-                                               receive_pos + target_buf,
-                                               agent->effector().queuedNextBallPos(),
-                                               ball_vel ) );
+        agent->addSayMessage( new Pooled< PassMessage >( receiver_unum,
+                                                         receive_pos + target_buf,
+                                                         agent->effector().queuedNextBallPos(),
+                                                         ball_vel ) );
     }
 }
@@ -36,6 +36,7 @@
 #include "bhv_strict_check_shoot.h"
 
 #include "shoot_generator.h"
+#include "pooled.h"
 
 #include <rcsc/action/neck_turn_to_goalie_or_scan.h>
 #include <rcsc/action/neck_turn_to_point.h>
@@ -113,7 +114,7 @@ Bhv_StrictCheckShoot::execute( PlayerAgent * agent )
                              one_step_speed * 0.99 - 0.0001,
                              1 ).execute( agent ) )
         {
-             agent->setNeckAction( new Neck_TurnToGoalieOrScan( -1 ) );
+             agent->setNeckAction( new Pooled< Neck_TurnToGoalieOrScan >( -1 ) );
              agent->debugClient().addMessage( "Force1Step" );
              return true;
         }
@@ -126,7 +127,7 @@ Bhv_StrictCheckShoot::execute( PlayerAgent * agent )
     {
         if ( ! doTurnNeckToShootPoint( agent, best_shoot->target_point_ ) )
         {
-            agent->setNeckAction( new Neck_TurnToGoalieOrScan( -1 ) );
+            agent->setNeckAction( new Pooled< Neck_TurnToGoalieOrScan >( -1 ) );
         }
         return true;
     }
@@ -183,7 +184,7 @@ Bhv_StrictCheckShoot::doTurnNeckToShootPoint( PlayerAgent * agent,
                   shoot_point.y );
     agent->debugClient().addMessage( "Shoot:NeckToTarget" );
 
-    agent->setNeckAction( new Neck_TurnToPoint( shoot_point ) );
+    agent->setNeckAction( new Pooled< Neck_TurnToPoint >( shoot_point ) );
 
     return true;
 }
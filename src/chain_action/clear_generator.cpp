@@ -36,6 +36,7 @@
 #include "clear_generator.h"
 
 #include "field_analyzer.h"
+#include "predict_ball_course.h"
 #include "clear_ball.h"
 
 #include <rcsc/action/kick_table.h>
@@ -382,6 +383,8 @@ ClearGenerator::predictOpponentsReachStep( const WorldModel & wm,
     int min_step = 50;
     int out_of_pitch_step = -1;
 
+    const PredictBallCourse ball_course( first_ball_pos, first_ball_vel, min_step );
+
     for ( AbstractPlayerCont::const_iterator
               o = wm.theirPlayers().begin(),
               end = wm.theirPlayers().end();
@@ -389,8 +392,7 @@ ClearGenerator::predictOpponentsReachStep( const WorldModel & wm,
           ++o )
     {
         int step = predictOpponentReachStep( *o,
-                                             first_ball_pos,
-                                             first_ball_vel,
+                                             ball_course,
                                              ball_move_angle,
                                              min_step );
         if ( step > 1000 )
@@ -423,8 +425,7 @@ ClearGenerator::predictOpponentsReachStep( const WorldModel & wm,
  */
 int
 ClearGenerator::predictOpponentReachStep( const AbstractPlayerObject * opponent,
-                                          const Vector2D & first_ball_pos,
-                                          const Vector2D & first_ball_vel,
+                                          const PredictBallCourse & ball_course,
                                           const AngleDeg & ball_move_angle,
                                           const int max_cycle )
 {
@@ -436,7 +437,7 @@ ClearGenerator::predictOpponentReachStep( const AbstractPlayerObject * opponent,
 
     int min_cycle = FieldAnalyzer::estimate_min_reach_cycle( opponent->pos(),
                                                              ptype->realSpeedMax(),
-                                                             first_ball_pos,
+                                                             ball_course.firstPos(),
                                                              ball_move_angle );
     if ( min_cycle < 0 )
     {
@@ -445,10 +446,7 @@ ClearGenerator::predictOpponentReachStep( const AbstractPlayerObject * opponent,
 
     for ( int cycle = min_cycle; cycle <= max_cycle; ++cycle )
     {
-        Vector2D ball_pos = inertia_n_step_point( first_ball_pos,
-                                                  first_ball_vel,
-                                                  cycle,
-                                                  SP.ballDecay() );
+        Vector2D ball_pos = ball_course.pos( cycle );
 
         if ( ball_pos.absX() > SP.pitchHalfLength()
              || ball_pos.absY() > SP.pitchHalfWidth() )
@@ -39,6 +39,8 @@
 
 #include <vector>
 
+class PredictBallCourse;
+
 namespace rcsc {
 class AbstractPlayerObject;
 class PlayerObject;
@@ -86,8 +88,7 @@ private:
                                    const double & first_ball_speed,
                                    const rcsc::AngleDeg & ball_move_angle );
     int predictOpponentReachStep( const rcsc::AbstractPlayerObject * opponent,
-                                  const rcsc::Vector2D & first_ball_pos,
-                                  const rcsc::Vector2D & first_ball_vel,
+                                  const PredictBallCourse & ball_course,
                                   const rcsc::AngleDeg & ball_move_angle,
                                   const int max_cycle );
 };
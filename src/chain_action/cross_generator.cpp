@@ -36,6 +36,8 @@
 #include "cross_generator.h"
 
 #include "field_analyzer.h"
+#include "ball_travel_table.h"
+#include "predict_ball_course.h"
 
 #include <rcsc/player/world_model.h>
 #include <rcsc/player/intercept_table.h>
@@ -474,9 +476,7 @@ CrossGenerator::createCross( const WorldModel & wm,
             {
                 ++M_total_count;
 
-                double first_ball_speed = calc_first_term_geom_series( ball_move_dist,
-                                                                       SP.ballDecay(),
-                                                                       step );
+                double first_ball_speed = BallTravelTable::i().firstSpeed( ball_move_dist, step );
                 if ( first_ball_speed < min_first_ball_speed )
                 {
 #ifdef DEBUG_PRINT_FAILED_COURSE
@@ -507,7 +507,7 @@ CrossGenerator::createCross( const WorldModel & wm,
                     continue;
                 }
 
-                double receive_ball_speed = first_ball_speed * std::pow( SP.ballDecay(), step );
+                double receive_ball_speed = first_ball_speed * BallTravelTable::i().decayPow( step );
                 if ( receive_ball_speed < MIN_RECEIVE_BALL_SPEED )
                 {
 #ifdef DEBUG_PRINT_FAILED_COURSE
@@ -619,6 +619,7 @@ CrossGenerator::checkOpponent( const Vector2D & first_ball_pos,
     const double receiver_dist = receiver->pos().dist( first_ball_pos );
     const Vector2D first_ball_vel
         = Vector2D( receive_pos - first_ball_pos ).setLength( first_ball_speed );
+    const PredictBallCourse ball_course( first_ball_pos, first_ball_vel, max_cycle );
 
     const AbstractPlayerCont::const_iterator end = M_opponents.end();
     for ( AbstractPlayerCont::const_iterator o = M_opponents.begin();
@@ -652,10 +653,7 @@ CrossGenerator::checkOpponent( const Vector2D & first_ball_pos,
               cycle <= max_cycle;
               ++cycle )
         {
-            Vector2D ball_pos = inertia_n_step_point( first_ball_pos,
-                                                      first_ball_vel,
-                                                      cycle,
-                                                      SP.ballDecay() );
+            Vector2D ball_pos = ball_course.pos( cycle );
             double target_dist = opponent_pos.dist( ball_pos );
 
             if ( target_dist - control_area - CONTROL_AREA_BUF < 0.001 )
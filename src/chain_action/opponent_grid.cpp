@@ -0,0 +1,229 @@
+// -*-c++-*-
+
+/*!
+  \file opponent_grid.cpp
+  \brief uniform grid index of opponent players Source File
+*/
+
+/*
+ *Copyright:
+
+ Copyright (C) Hiroki SHIMORA, Hidehisa AKIYAMA
+
+ This code is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 3, or (at your option)
+ any later version.
+
+ This code is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this code; see the file COPYING.  If not, write to
+ the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+
+ *EndCopyright:
+ */
+
+/////////////////////////////////////////////////////////////////////
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "opponent_grid.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace rcsc;
+
+const double OpponentGrid::CELL_SIZE = 5.0;
+
+namespace {
+
+// the grid covers the pitch and its surroundings.
+// positions outside of the area are clamped to the border cells.
+const double GRID_MIN_X = -60.0;
+const double GRID_MIN_Y = -40.0;
+const int GRID_COLUMNS = 24;
+const int GRID_ROWS = 16;
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+double
+segment_dist( const Vector2D & from,
+              const Vector2D & to,
+              const Vector2D & p )
+{
+    const Vector2D dir = to - from;
+    const double len2 = dir.r2();
+
+    if ( len2 < 1.0e-10 )
+    {
+        return from.dist( p );
+    }
+
+    const double t = std::min( 1.0, std::max( 0.0, ( p - from ).innerProduct( dir ) / len2 ) );
+    return p.dist( from + dir * t );
+}
+
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+OpponentGrid::OpponentGrid()
+    : M_max_margin( 0.0 ),
+      M_max_speed( 0.0 )
+{
+    M_entries.reserve( 16 );
+    M_cell_start.assign( GRID_COLUMNS * GRID_ROWS + 1, 0 );
+    M_cell_cursor.reserve( GRID_COLUMNS * GRID_ROWS );
+    M_cell_items.reserve( 16 );
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+int
+OpponentGrid::cellX( const double & x ) const
+{
+    const int ix = static_cast< int >( std::floor( ( x - GRID_MIN_X ) / CELL_SIZE ) );
+    return std::min( GRID_COLUMNS - 1, std::max( 0, ix ) );
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+int
+OpponentGrid::cellY( const double & y ) const
+{
+    const int iy = static_cast< int >( std::floor( ( y - GRID_MIN_Y ) / CELL_SIZE ) );
+    return std::min( GRID_ROWS - 1, std::max( 0, iy ) );
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+void
+OpponentGrid::clear()
+{
+    M_entries.clear();
+    M_cell_items.clear();
+    std::fill( M_cell_start.begin(), M_cell_start.end(), 0 );
+    M_max_margin = 0.0;
+    M_max_speed = 0.0;
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+int
+OpponentGrid::add( const Vector2D & pos,
+                   const double & margin,
+                   const double & speed )
+{
+    Entry e;
+    e.pos_ = pos;
+    e.margin_ = std::max( 0.0, margin );
+    e.speed_ = std::max( 0.0, speed );
+    e.cell_ = 0;
+
+    M_entries.push_back( e );
+
+    M_max_margin = std::max( M_max_margin, e.margin_ );
+    M_max_speed = std::max( M_max_speed, e.speed_ );
+
+    return static_cast< int >( M_entries.size() ) - 1;
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+void
+OpponentGrid::build()
+{
+    const int n = static_cast< int >( M_entries.size() );
+
+    //
+    // counting sort of the entries by cell index
+    //
+    std::fill( M_cell_start.begin(), M_cell_start.end(), 0 );
+
+    for ( int i = 0; i < n; ++i )
+    {
+        Entry & e = M_entries[i];
+        e.cell_ = cellY( e.pos_.y ) * GRID_COLUMNS + cellX( e.pos_.x );
+        ++M_cell_start[e.cell_ + 1];
+    }
+
+    for ( size_t c = 1; c < M_cell_start.size(); ++c )
+    {
+        M_cell_start[c] += M_cell_start[c - 1];
+    }
+
+    M_cell_items.resize( n );
+    M_cell_cursor.assign( M_cell_start.begin(), M_cell_start.end() - 1 );
+
+    for ( int i = 0; i < n; ++i )
+    {
+        M_cell_items[ M_cell_cursor[ M_entries[i].cell_ ]++ ] = i;
+    }
+}
+
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+void
+OpponentGrid::query( const Vector2D & from,
+                     const Vector2D & to,
+                     const int horizon,
+                     std::vector< int > * result ) const
+{
+    result->clear();
+
+    if ( M_entries.empty() )
+    {
+        return;
+    }
+
+    const double max_reach = M_max_margin + M_max_speed * std::max( 0, horizon );
+
+    const int min_x = cellX( std::min( from.x, to.x ) - max_reach );
+    const int max_x = cellX( std::max( from.x, to.x ) + max_reach );
+    const int min_y = cellY( std::min( from.y, to.y ) - max_reach );
+    const int max_y = cellY( std::max( from.y, to.y ) + max_reach );
+
+    for ( int iy = min_y; iy <= max_y; ++iy )
+    {
+        for ( int ix = min_x; ix <= max_x; ++ix )
+        {
+            const int cell = iy * GRID_COLUMNS + ix;
+
+            for ( int k = M_cell_start[cell]; k < M_cell_start[cell + 1]; ++k )
+            {
+                const Entry & e = M_entries[ M_cell_items[k] ];
+                const double reach = e.margin_ + e.speed_ * std::max( 0, horizon );
+
+                if ( segment_dist( from, to, e.pos_ ) <= reach )
+                {
+                    result->push_back( M_cell_items[k] );
+                }
+            }
+        }
+    }
+
+    std::sort( result->begin(), result->end() );
+}
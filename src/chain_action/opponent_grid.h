@@ -0,0 +1,142 @@
+// -*-c++-*-
+
+/*!
+  \file opponent_grid.h
+  \brief uniform grid index of opponent players Header File
+*/
+
+/*
+ *Copyright:
+
+ Copyright (C) Hiroki SHIMORA, Hidehisa AKIYAMA
+
+ This code is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 3, or (at your option)
+ any later version.
+
+ This code is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this code; see the file COPYING.  If not, write to
+ the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+
+ *EndCopyright:
+ */
+
+/////////////////////////////////////////////////////////////////////
+
+#ifndef OPPONENT_GRID_H
+#define OPPONENT_GRID_H
+
+#include <rcsc/geom/vector_2d.h>
+
+#include <vector>
+
+/*!
+  \class OpponentGrid
+  \brief uniform grid over the field that buckets opponent positions.
+
+  Each entry has a base position and a conservative reach model:
+  the opponent is able to touch a point only if the distance to the point
+  is within margin + speed * horizon. Generators register their opponents
+  once per cycle with the reach model of their own opponent check, and
+  then query only the entries that may reach the ball course.
+  Entry indices are the registration order, and query results are sorted
+  in that order.
+ */
+class OpponentGrid {
+public:
+    //! cell edge length
+    static const double CELL_SIZE;
+
+private:
+
+    struct Entry {
+        rcsc::Vector2D pos_; //!< base position
+        double margin_; //!< reachable distance without any dash
+        double speed_; //!< reachable distance per cycle
+        int cell_; //!< cell index
+    };
+
+    std::vector< Entry > M_entries;
+
+    //! start index of each cell in M_cell_items (size = cells + 1)
+    std::vector< int > M_cell_start;
+
+    //! entry indices ordered by cell
+    std::vector< int > M_cell_items;
+
+    //! work area for build()
+    std::vector< int > M_cell_cursor;
+
+    double M_max_margin;
+    double M_max_speed;
+
+    int cellX( const double & x ) const;
+    int cellY( const double & y ) const;
+
+public:
+
+    OpponentGrid();
+
+    /*!
+      \brief remove all entries
+     */
+    void clear();
+
+    /*!
+      \brief register an opponent. build() has to be called after all entries are added.
+      \param pos base position
+      \param margin reachable distance without any dash
+      \param speed reachable distance per cycle
+      \return index of the entry
+     */
+    int add( const rcsc::Vector2D & pos,
+             const double & margin,
+             const double & speed );
+
+    /*!
+      \brief bucket the registered entries
+     */
+    void build();
+
+    /*!
+      \brief get the number of registered entries
+      \return the number of entries
+     */
+    int size() const
+      {
+          return static_cast< int >( M_entries.size() );
+      }
+
+    /*!
+      \brief get the entries that may reach the segment within horizon cycles
+      \param from first point of the ball course
+      \param to last point of the ball course
+      \param horizon the number of cycles
+      \param result container to store the entry indices (cleared in this method)
+     */
+    void query( const rcsc::Vector2D & from,
+                const rcsc::Vector2D & to,
+                const int horizon,
+                std::vector< int > * result ) const;
+
+    /*!
+      \brief get the entries that may reach the point within horizon cycles
+      \param point target point
+      \param horizon the number of cycles
+      \param result container to store the entry indices (cleared in this method)
+     */
+    void query( const rcsc::Vector2D & point,
+                const int horizon,
+                std::vector< int > * result ) const
+      {
+          query( point, point, horizon, result );
+      }
+};
+
+#endif
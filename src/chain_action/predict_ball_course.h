@@ -0,0 +1,143 @@
+// -*-c++-*-
+
+/*!
+  \file predict_ball_course.h
+  \brief predicted ball trajectory table Header File
+*/
+
+/*
+ *Copyright:
+
+ Copyright (C) Hiroki SHIMORA, Hidehisa AKIYAMA
+
+ This code is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 3, or (at your option)
+ any later version.
+
+ This code is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this code; see the file COPYING.  If not, write to
+ the Free Software Foundation, 675 Mass Ave, Cambridge, MA 02139, USA.
+
+ *EndCopyright:
+ */
+
+/////////////////////////////////////////////////////////////////////
+
+#ifndef RCSC_PLAYER_PREDICT_BALL_COURSE_H
+#define RCSC_PLAYER_PREDICT_BALL_COURSE_H
+
+#include <rcsc/common/server_param.h>
+#include <rcsc/geom/vector_2d.h>
+#include <rcsc/soccer_math.h>
+
+#include <algorithm>
+
+/*!
+  \class PredictBallCourse
+  \brief ball positions of one kick course over the prediction horizon.
+
+  The positions are computed once per course and shared by every opponent
+  check, instead of calling inertia_n_step_point() for each opponent and
+  each cycle. Coordinates are stored as separate x/y arrays, and the fill
+  loop has no loop-carried dependency except the decay power, so that the
+  compiler can vectorize it.
+ */
+class PredictBallCourse {
+public:
+    //! the number of cycles stored in the table
+    static const int MAX_STEP = 64;
+
+private:
+    rcsc::Vector2D M_first_pos;
+    rcsc::Vector2D M_first_vel;
+    double M_decay;
+    int M_size;
+
+    double M_x[MAX_STEP + 1];
+    double M_y[MAX_STEP + 1];
+
+    // not used
+    PredictBallCourse( const PredictBallCourse & );
+    PredictBallCourse & operator=( const PredictBallCourse & );
+
+public:
+
+    /*!
+      \brief compute the ball positions from step 0 to max_step
+      \param first_pos ball first position
+      \param first_vel ball first velocity
+      \param max_step the last cycle that will be queried
+     */
+    PredictBallCourse( const rcsc::Vector2D & first_pos,
+                       const rcsc::Vector2D & first_vel,
+                       const int max_step )
+        : M_first_pos( first_pos ),
+          M_first_vel( first_vel ),
+          M_decay( rcsc::ServerParam::i().ballDecay() ),
+          M_size( std::max( 0, std::min( max_step, MAX_STEP ) ) + 1 )
+      {
+          double decay_n[MAX_STEP + 1];
+
+          decay_n[0] = 1.0;
+          for ( int i = 1; i < M_size; ++i )
+          {
+              decay_n[i] = decay_n[i - 1] * M_decay;
+          }
+
+          // same as inertia_n_step_distance(), with the decay powers reused.
+          const double inv_rate = 1.0 / ( 1.0 - M_decay );
+          const double px = first_pos.x;
+          const double py = first_pos.y;
+          const double vx = first_vel.x * inv_rate;
+          const double vy = first_vel.y * inv_rate;
+
+          for ( int i = 0; i < M_size; ++i )
+          {
+              const double move_rate = 1.0 - decay_n[i];
+              M_x[i] = px + vx * move_rate;
+              M_y[i] = py + vy * move_rate;
+          }
+      }
+
+    const rcsc::Vector2D & firstPos() const
+      {
+          return M_first_pos;
+      }
+
+    const rcsc::Vector2D & firstVel() const
+      {
+          return M_first_vel;
+      }
+
+    /*!
+      \brief get the number of stored cycles
+      \return size of the table, includes step 0
+     */
+    int size() const
+      {
+          return M_size;
+      }
+
+    /*!
+      \brief get the predicted ball position
+      \param step cycles after the kick
+      \return ball position. steps beyond the table are computed directly.
+     */
+    rcsc::Vector2D pos( const int step ) const
+      {
+          if ( 0 <= step && step < M_size )
+          {
+              return rcsc::Vector2D( M_x[step], M_y[step] );
+          }
+
+          return rcsc::inertia_n_step_point( M_first_pos, M_first_vel, step, M_decay );
+      }
+};
+
+#endif
@@ -34,6 +34,7 @@
 #endif
 
 #include "predict_state.h"
+#include "pooled.h"
 
 #include <rcsc/common/server_param.h>
 
@@ -56,6 +57,7 @@ PredictState::PredictState( const WorldModel & wm )
       M_ball(),
       M_self_unum( Unum_Unknown ),
       M_our_players(),
+      M_opponents_or_unknown(),
       M_our_defense_line_x( 0.0 ),
       M_our_offense_player_line_x( 0.0 )
 {
@@ -74,6 +76,7 @@ PredictState::PredictState( const PredictState & rhs,
       M_ball( rhs.M_ball ),
       M_self_unum( rhs.M_self_unum ),
       M_our_players( rhs.M_our_players ),
+      M_opponents_or_unknown( rhs.M_opponents_or_unknown ),
       M_our_defense_line_x( rhs.M_our_defense_line_x ),
       M_our_offense_player_line_x( rhs.M_our_offense_player_line_x )
 {
@@ -94,12 +97,18 @@ PredictState::PredictState( const PredictState & rhs,
       M_ball( ball_and_holder_pos ),
       M_self_unum( rhs.M_self_unum ),
       M_our_players( rhs.M_our_players ),
+      M_opponents_or_unknown( rhs.M_opponents_or_unknown ),
       M_our_defense_line_x( rhs.M_our_defense_line_x ),
       M_our_offense_player_line_x( std::max( rhs.M_our_offense_player_line_x,
                                              ball_and_holder_pos.x ) )
 {
-    M_our_players[ ball_holder_unum - 1 ]
-        = PredictPlayerObject::Ptr( new PredictPlayerObject( *(M_our_players[ ball_holder_unum - 1 ] ),
+    //
+    // copy on write: only the holder is replaced, other players are shared with rhs.
+    //
+    M_our_players = boost::shared_ptr< PredictPlayerPtrCont >( new PredictPlayerPtrCont( *rhs.M_our_players ) );
+
+    (*M_our_players)[ ball_holder_unum - 1 ]
+        = PredictPlayerObject::Ptr( new PredictPlayerObject( *(*rhs.M_our_players)[ ball_holder_unum - 1 ],
                                                              ball_and_holder_pos ) );
 
     updateLines();
@@ -118,6 +127,7 @@ PredictState::PredictState( const PredictState & rhs,
       M_ball( ball_pos ),
       M_self_unum( rhs.M_self_unum ),
       M_our_players( rhs.M_our_players ),
+      M_opponents_or_unknown( rhs.M_opponents_or_unknown ),
       M_our_defense_line_x( rhs.M_our_defense_line_x ),
       M_our_offense_player_line_x( rhs.M_our_offense_player_line_x )
 {
@@ -169,7 +179,8 @@ PredictState::init( const WorldModel & wm )
     //
     // initialize all teammates
     //
-    M_our_players.reserve( 11 );
+    boost::shared_ptr< PredictPlayerPtrCont > our_players( new PredictPlayerPtrCont() );
+    our_players->reserve( 11 );
 
     for ( int n = 1; n <= 11; ++n )
     {
@@ -194,7 +205,7 @@ PredictState::init( const WorldModel & wm )
             }
         }
 
-        M_our_players.push_back( ptr );
+        our_players->push_back( ptr );
 
 #ifndef STRICT_LINE_UPDATE
         if ( ptr->isValid()
@@ -205,6 +216,16 @@ PredictState::init( const WorldModel & wm )
 #endif
     }
 
+    M_our_players = our_players;
+
+    //
+    // initialize opponent view.
+    // successors never change the side of our players, so this result is valid for all of them.
+    //
+    M_opponents_or_unknown
+        = boost::shared_ptr< const AbstractPlayerCont >
+        ( new AbstractPlayerCont( getPlayerCont( new Pooled< OpponentOrUnknownPlayerPredicate >( wm.ourSide() ) ) ) );
+
     updateLines();
 }
 
@@ -247,8 +268,8 @@ PredictState::getPlayerCont( const PlayerPredicate * predicate ) const
     }
 
     for ( PredictPlayerPtrCont::const_iterator
-              it = M_our_players.begin(),
-              end = M_our_players.end();
+              it = M_our_players->begin(),
+              end = M_our_players->end();
           it != end;
           ++it )
     {
@@ -62,8 +62,11 @@ private:
 
     int M_self_unum;
 
-    PredictPlayerPtrCont M_our_players;
+    //! teammate container. shared with the parent state until a player is moved (copy-on-write).
+    boost::shared_ptr< PredictPlayerPtrCont > M_our_players;
 
+    //! opponent or unknown players. built once by the root state and shared by all successors.
+    boost::shared_ptr< const rcsc::AbstractPlayerCont > M_opponents_or_unknown;
 
     double M_our_defense_line_x;
     double M_our_offense_player_line_x;
@@ -126,10 +129,10 @@ public:
               std::cerr << "internal error: "
                         << __FILE__ << ":" << __LINE__
                         << "invalid self unum " << M_self_unum << std::endl;
-              return *(M_our_players[0]);
+              return *(*M_our_players)[0];
           }
 
-          return *(M_our_players[ M_self_unum - 1 ]);
+          return *(*M_our_players)[ M_self_unum - 1 ];
       }
 
     const rcsc::AbstractPlayerObject * ourPlayer( const int unum ) const
@@ -142,7 +145,7 @@ public:
               return static_cast< const rcsc::AbstractPlayerObject * >( 0 );
           }
 
-          return &( *(M_our_players[ unum - 1 ]) );
+          return &( *(*M_our_players)[ unum - 1 ] );
       }
 
     const rcsc::AbstractPlayerObject * theirPlayer( const int unum ) const
@@ -152,7 +155,18 @@ public:
 
     const PredictPlayerPtrCont & ourPlayers() const
       {
-          return M_our_players;
+          return *M_our_players;
+      }
+
+    /*!
+      \brief get the players that satisfy OpponentOrUnknownPlayerPredicate.
+      This container is shared by all states derived from the same root,
+      so no allocation is needed for each evaluation.
+      \return const reference to the player container
+    */
+    const rcsc::AbstractPlayerCont & opponentsOrUnknown() const
+      {
+          return *M_opponents_or_unknown;
       }
 
     const rcsc::PlayerCont & opponents() const
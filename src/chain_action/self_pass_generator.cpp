@@ -37,6 +37,7 @@
 
 #include "dribble.h"
 #include "field_analyzer.h"
+#include "ball_travel_table.h"
 
 #include <rcsc/action/kick_table.h>
 #include <rcsc/player/world_model.h>
@@ -85,6 +86,7 @@ debug_paint_failed( const int count,
 SelfPassGenerator::SelfPassGenerator()
 {
     M_courses.reserve( 128 );
+    M_opponent_candidates.reserve( 16 );
 
     clear();
 }
@@ -113,6 +115,7 @@ SelfPassGenerator::clear()
 {
     M_total_count = 0;
     M_courses.clear();
+    M_opponent_grid.clear();
 }
 
 /*-------------------------------------------------------------------*/
@@ -146,6 +149,7 @@ SelfPassGenerator::generate( const WorldModel & wm )
     Timer timer;
 #endif
 
+    updateOpponents( wm );
     createCourses( wm );
 
     std::sort( M_courses.begin(), M_courses.end(),
@@ -160,6 +164,46 @@ SelfPassGenerator::generate( const WorldModel & wm )
 #endif
 }
 
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+void
+SelfPassGenerator::updateOpponents( const WorldModel & wm )
+{
+    const ServerParam & SP = ServerParam::i();
+
+    //
+    // register the upper bound of the reachable distance used in checkOpponent().
+    // the opponent is ignored if the distance to the receive point is over
+    // inertia move + control area + speed * ( self_step + posCount ).
+    //
+    const PlayerPtrCont::const_iterator o_end = wm.opponentsFromSelf().end();
+    for ( PlayerPtrCont::const_iterator o = wm.opponentsFromSelf().begin();
+          o != o_end;
+          ++o )
+    {
+        const Vector2D & opos = ( (*o)->seenPosCount() <= (*o)->posCount()
+                                  ? (*o)->seenPos()
+                                  : (*o)->pos() );
+        const Vector2D & ovel = ( (*o)->seenVelCount() <= (*o)->velCount()
+                                  ? (*o)->seenVel()
+                                  : (*o)->vel() );
+        const PlayerType * ptype = (*o)->playerTypePtr();
+        const double control_area = ( (*o)->goalie()
+                                      ? std::max( SP.catchableArea(), ptype->kickableArea() )
+                                      : ptype->kickableArea() );
+        const double margin = ovel.r() / ( 1.0 - ptype->playerDecay() )
+            + control_area
+            + 0.01
+            + ptype->realSpeedMax() * (*o)->posCount();
+
+        M_opponent_grid.add( opos, margin, ptype->realSpeedMax() );
+    }
+
+    M_opponent_grid.build();
+}
+
 /*-------------------------------------------------------------------*/
 /*!
 
@@ -471,9 +515,8 @@ SelfPassGenerator::canKick( const WorldModel & wm,
     //
     // check kick possibility
     //
-    double first_speed = calc_first_term_geom_series( ball_pos.dist( receive_pos ),
-                                                      SP.ballDecay(),
-                                                      1 + n_turn + n_dash );
+    double first_speed = BallTravelTable::i().firstSpeed( ball_pos.dist( receive_pos ),
+                                                          1 + n_turn + n_dash );
     Vector2D max_vel = KickTable::calc_max_velocity( target_angle,
                                                      wm.self().kickRate(),
                                                      ball_vel );
@@ -605,11 +648,13 @@ SelfPassGenerator::checkOpponent( const WorldModel & wm,
 
     int min_step = 1000;
 
-    const PlayerPtrCont::const_iterator o_end = wm.opponentsFromSelf().end();
-    for ( PlayerPtrCont::const_iterator o = wm.opponentsFromSelf().begin();
-          o != o_end;
-          ++o )
+    M_opponent_grid.query( receive_pos, self_step, &M_opponent_candidates );
+
+    for ( std::vector< int >::const_iterator i = M_opponent_candidates.begin();
+          i != M_opponent_candidates.end();
+          ++i )
     {
+        const PlayerPtrCont::const_iterator o = wm.opponentsFromSelf().begin() + *i;
         const Vector2D & opos = ( (*o)->seenPosCount() <= (*o)->posCount()
                                   ? (*o)->seenPos()
                                   : (*o)->pos() );
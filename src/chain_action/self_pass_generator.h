@@ -33,6 +33,7 @@
 #define SELF_PASS_GENERATOR_H
 
 #include "cooperative_action.h"
+#include "opponent_grid.h"
 
 #include <rcsc/player/abstract_player_object.h>
 #include <rcsc/geom/vector_2d.h>
@@ -53,6 +54,9 @@ private:
 
     std::vector< CooperativeAction::Ptr > M_courses;
 
+    OpponentGrid M_opponent_grid; //!< spatial index of wm.opponentsFromSelf()
+    std::vector< int > M_opponent_candidates; //!< work area for grid queries
+
     // private for singleton
     SelfPassGenerator();
 
@@ -76,6 +80,8 @@ private:
 
     void clear();
 
+    void updateOpponents( const rcsc::WorldModel & wm );
+
     void createCourses( const rcsc::WorldModel & wm );
 
     void createSelfCache( const rcsc::WorldModel & wm,
@@ -36,6 +36,8 @@
 #include "shoot_generator.h"
 
 #include "field_analyzer.h"
+#include "ball_travel_table.h"
+#include "predict_ball_course.h"
 
 #include <rcsc/action/kick_table.h>
 
@@ -349,9 +351,7 @@ ShootGenerator::createShoot( const WorldModel & wm,
     const ServerParam & SP = ServerParam::i();
 
     const int ball_reach_step
-        = static_cast< int >( std::ceil( calc_length_geom_series( first_ball_speed,
-                                                                   ball_move_dist,
-                                                                   SP.ballDecay() ) ) );
+        = BallTravelTable::i().reachStep( first_ball_speed, ball_move_dist );
 #ifdef DEBUG_PRINT
     dlog.addText( Logger::SHOOT,
                   "%d: target=(%.2f %.2f) speed=%.3f angle=%.1f"
@@ -383,6 +383,10 @@ ShootGenerator::createShoot( const WorldModel & wm,
 
     // estimate opponent interception
 
+    const PredictBallCourse ball_course( M_first_ball_pos,
+                                         course.first_ball_vel_,
+                                         ball_reach_step );
+
     const double opponent_x_thr = SP.theirPenaltyAreaLineX() - 30.0;
     const double opponent_y_thr = SP.penaltyAreaHalfWidth();
 
@@ -403,7 +407,7 @@ ShootGenerator::createShoot( const WorldModel & wm,
 
         if ( (*o)->goalie() )
         {
-            if ( maybeGoalieCatch( *o, course ) )
+            if ( maybeGoalieCatch( *o, ball_course, course ) )
             {
 #ifdef DEBUG_PRINT
                 dlog.addText( Logger::SHOOT,
@@ -422,7 +426,7 @@ ShootGenerator::createShoot( const WorldModel & wm,
         if ( (*o)->posCount() > 10 ) continue;
         if ( (*o)->isGhost() && (*o)->posCount() > 5 ) continue;
 
-        if ( opponentCanReach( *o, course ) )
+        if ( opponentCanReach( *o, ball_course, course ) )
         {
 #ifdef DEBUG_PRINT
                 dlog.addText( Logger::SHOOT,
@@ -443,6 +447,7 @@ ShootGenerator::createShoot( const WorldModel & wm,
  */
 bool
 ShootGenerator::maybeGoalieCatch( const PlayerObject * goalie,
+                                  const PredictBallCourse & ball_course,
                                   Course & course )
 {
     static const Rect2D penalty_area( Vector2D( ServerParam::i().theirPenaltyAreaLineX(),
@@ -482,10 +487,7 @@ ShootGenerator::maybeGoalieCatch( const PlayerObject * goalie,
 
     for ( int cycle = min_cycle; cycle < max_cycle; ++cycle )
     {
-        const Vector2D ball_pos = inertia_n_step_point( M_first_ball_pos,
-                                                        course.first_ball_vel_,
-                                                        cycle,
-                                                        SP.ballDecay() );
+        const Vector2D ball_pos = ball_course.pos( cycle );
         if ( ball_pos.x > SP.pitchHalfLength() )
         {
 #ifdef DEBUG_PRINT
@@ -617,10 +619,9 @@ ShootGenerator::maybeGoalieCatch( const PlayerObject * goalie,
  */
 bool
 ShootGenerator::opponentCanReach( const PlayerObject * opponent,
+                                  const PredictBallCourse & ball_course,
                                   Course & course )
 {
-    const ServerParam & SP = ServerParam::i();
-
     const PlayerType * ptype = opponent->playerTypePtr();
     const double control_area = ptype->kickableArea();
 
@@ -651,10 +652,7 @@ ShootGenerator::opponentCanReach( const PlayerObject * opponent,
 
     for ( int cycle = min_cycle; cycle < max_cycle; ++cycle )
     {
-        Vector2D ball_pos = inertia_n_step_point( M_first_ball_pos,
-                                                  course.first_ball_vel_,
-                                                  cycle,
-                                                  SP.ballDecay() );
+        Vector2D ball_pos = ball_course.pos( cycle );
 
         Vector2D inertia_pos = opponent->inertiaPoint( cycle );
         double target_dist = inertia_pos.dist( ball_pos );
@@ -38,6 +38,8 @@
 #include <functional>
 #include <vector>
 
+class PredictBallCourse;
+
 namespace rcsc {
 class PlayerAgent;
 class PlayerObject;
@@ -167,9 +169,11 @@ private:
                       const double & ball_move_dist );
 
     bool maybeGoalieCatch( const rcsc::PlayerObject * goalie,
+                           const PredictBallCourse & ball_course,
                            Course & course );
 
     bool opponentCanReach( const rcsc::PlayerObject * opponent,
+                           const PredictBallCourse & ball_course,
                            Course & course );
 
     void evaluateCourses( const rcsc::WorldModel & wm );
@@ -37,6 +37,7 @@
 
 #include "dribble.h"
 #include "field_analyzer.h"
+#include "ball_travel_table.h"
 
 #include <rcsc/player/world_model.h>
 #include <rcsc/player/intercept_table.h>
@@ -87,6 +88,7 @@ ShortDribbleGenerator::ShortDribbleGenerator()
     : M_queued_action_time( 0, 0 )
 {
     M_courses.reserve( 128 );
+    M_opponent_candidates.reserve( 16 );
 
     clear();
 }
@@ -117,6 +119,7 @@ ShortDribbleGenerator::clear()
     M_first_ball_pos = Vector2D::INVALIDATED;
     M_first_ball_vel.assign( 0.0, 0.0 );
     M_courses.clear();
+    M_opponent_grid.clear();
 }
 
 /*-------------------------------------------------------------------*/
@@ -178,6 +181,7 @@ ShortDribbleGenerator::generate( const WorldModel & wm )
     Timer timer;
 #endif
 
+    updateOpponents( wm );
     createCourses( wm );
 
     std::sort( M_courses.begin(), M_courses.end(),
@@ -204,6 +208,43 @@ ShortDribbleGenerator::setQueuedAction( const rcsc::WorldModel & wm,
     M_queued_action = action;
 }
 
+/*-------------------------------------------------------------------*/
+/*!
+
+ */
+void
+ShortDribbleGenerator::updateOpponents( const WorldModel & wm )
+{
+    const ServerParam & SP = ServerParam::i();
+
+    //
+    // register the upper bound of the reachable distance used in checkOpponent().
+    // the opponent can reach the trap point only if n_dash <= dribble_step + bonus_step,
+    // and bonus_step is at most 2 + min( posCount, 8 ).
+    //
+    const PlayerPtrCont::const_iterator o_end = wm.opponentsFromSelf().end();
+    for ( PlayerPtrCont::const_iterator o = wm.opponentsFromSelf().begin();
+          o != o_end;
+          ++o )
+    {
+        if ( (*o)->distFromSelf() > 20.0 ) break;
+
+        const PlayerType * ptype = (*o)->playerTypePtr();
+        const double control_area = ( (*o)->goalie()
+                                      ? std::max( SP.catchableArea(), ptype->kickableArea() )
+                                      : ptype->kickableArea() );
+        const double dash_margin = control_area * 0.5 + 0.2
+            + ptype->realSpeedMax() * ( 2 + std::min( (*o)->posCount(), 8 ) );
+        const double margin = (*o)->vel().r() / ( 1.0 - ptype->playerDecay() )
+            + std::max( control_area, dash_margin )
+            + 0.01;
+
+        M_opponent_grid.add( (*o)->pos(), margin, ptype->realSpeedMax() );
+    }
+
+    M_opponent_grid.build();
+}
+
 /*-------------------------------------------------------------------*/
 /*!
 
@@ -586,8 +627,7 @@ ShortDribbleGenerator::simulateKickTurnsDashes( const WorldModel & wm,
         }
 
         const double term
-            = ( 1.0 - std::pow( SP.ballDecay(), 1 + n_turn + n_dash ) )
-            / ( 1.0 - SP.ballDecay() );
+            = BallTravelTable::i().travelDistance( 1.0, 1 + n_turn + n_dash );
         const Vector2D first_vel = ( ball_trap_pos - M_first_ball_pos ) / term;
         const Vector2D kick_accel = first_vel - M_first_ball_vel;
         const double kick_power = kick_accel.r() / wm.self().kickRate();
@@ -722,12 +762,13 @@ ShortDribbleGenerator::checkOpponent( const WorldModel & wm,
     //const double control_area = SP.tackleDist() - 0.2;
     const rcsc::AngleDeg ball_move_angle = ( ball_trap_pos - M_first_ball_pos ).th();
 
-    const PlayerPtrCont::const_iterator o_end = wm.opponentsFromSelf().end();
-    for ( PlayerPtrCont::const_iterator o = wm.opponentsFromSelf().begin();
-          o != o_end;
-          ++o )
+    M_opponent_grid.query( ball_trap_pos, dribble_step, &M_opponent_candidates );
+
+    for ( std::vector< int >::const_iterator i = M_opponent_candidates.begin();
+          i != M_opponent_candidates.end();
+          ++i )
     {
-        if ( (*o)->distFromSelf() > 20.0 ) break;
+        const PlayerPtrCont::const_iterator o = wm.opponentsFromSelf().begin() + *i;
 
         const PlayerType * ptype = (*o)->playerTypePtr();
 
@@ -37,6 +37,8 @@
 
 #include "pass.h"
 #include "field_analyzer.h"
+#include "ball_travel_table.h"
+#include "predict_ball_course.h"
 
 #include <rcsc/player/world_model.h>
 #include <rcsc/player/intercept_table.h>
@@ -141,6 +143,7 @@ StrictCheckPassGenerator::StrictCheckPassGenerator()
 {
     M_receiver_candidates.reserve( 11 );
     M_opponents.reserve( 16 );
+    M_opponent_candidates.reserve( 16 );
     M_courses.reserve( 1024 );
 
     clear();
@@ -175,6 +178,7 @@ StrictCheckPassGenerator::clear()
     M_first_point.invalidate();
     M_receiver_candidates.clear();
     M_opponents.clear();
+    M_opponent_grid.clear();
     M_direct_size = M_leading_size = M_through_size = 0;
     M_courses.clear();
 }
@@ -469,8 +473,27 @@ StrictCheckPassGenerator::updateOpponents( const WorldModel & wm )
           ++p )
     {
         M_opponents.push_back( Opponent( *p ) );
-#ifdef DEBUG_UPDATE_OPPONENT
+
+        //
+        // register the upper bound of the reachable distance used in predictOpponentReachStep().
+        // the opponent can reach the ball at cycle n only if the distance is within
+        // inertia move + bonus + control area + buffer + speed * ( n + min( posCount, 5 ) ).
+        //
         const Opponent & o = M_opponents.back();
+        const PlayerType * ptype = o.player_->playerTypePtr();
+        const double control_area = ( o.player_->goalie()
+                                      ? std::max( ServerParam::i().catchableArea(),
+                                                  ptype->kickableArea() )
+                                      : ptype->kickableArea() );
+        const double margin = o.speed_ / ( 1.0 - ptype->playerDecay() )
+            + std::max( 0.0, o.bonus_distance_ )
+            + control_area
+            + 0.5 + 0.01
+            + ptype->realSpeedMax() * std::min( o.player_->posCount(), 5 );
+
+        M_opponent_grid.add( o.pos_, margin, ptype->realSpeedMax() );
+
+#ifdef DEBUG_UPDATE_OPPONENT
         dlog.addText( Logger::PASS,
                       "StrictPass opp %d pos(%.1f %.1f) vel(%.2f %.2f) bonus_dist=%.3f",
                       o.player_->unum(),
@@ -479,6 +502,8 @@ StrictCheckPassGenerator::updateOpponents( const WorldModel & wm )
                       o.bonus_distance_ );
 #endif
     }
+
+    M_opponent_grid.build();
 }
 
 /*-------------------------------------------------------------------*/
@@ -1175,9 +1200,7 @@ StrictCheckPassGenerator::createPassCommon( const WorldModel & wm,
     {
         ++M_total_count;
 
-        double first_ball_speed = calc_first_term_geom_series( ball_move_dist,
-                                                               SP.ballDecay(),
-                                                               step );
+        double first_ball_speed = BallTravelTable::i().firstSpeed( ball_move_dist, step );
 
 #if (defined DEBUG_PRINT_DIRECT_PASS) || (defined DEBUG_PRINT_LEADING_PASS) || (defined DEBUG_PRINT_THROUGH_PASS) || (defined DEBUG_PRINT_FAILED_PASS)
         dlog.addText( Logger::PASS,
@@ -1220,7 +1243,7 @@ StrictCheckPassGenerator::createPassCommon( const WorldModel & wm,
             continue;
         }
 
-        double receive_ball_speed = first_ball_speed * std::pow( SP.ballDecay(), step );
+        double receive_ball_speed = first_ball_speed * BallTravelTable::i().decayPow( step );
         if ( receive_ball_speed < min_receive_ball_speed )
         {
 #ifdef DEBUG_PRINT_FAILED_PASS
@@ -1553,19 +1576,28 @@ StrictCheckPassGenerator::predictOpponentsReachStep( const WorldModel & wm,
                                                      const AbstractPlayerObject ** opponent )
 {
     const Vector2D first_ball_vel = Vector2D::polar2vector( first_ball_speed, ball_move_angle );
+    const PredictBallCourse ball_course( first_ball_pos, first_ball_vel, max_cycle );
 
     double bonus_dist = -10000.0;
     int min_step = 1000;
     const AbstractPlayerObject * fastest_opponent = static_cast< AbstractPlayerObject * >( 0 );
 
-    for ( OpponentCont::const_iterator o = M_opponents.begin();
-          o != M_opponents.end();
-          ++o )
+    //
+    // opponents that cannot reach the ball course within max_cycle are never the fastest.
+    //
+    M_opponent_grid.query( ball_course.firstPos(),
+                           ball_course.pos( max_cycle ),
+                           max_cycle,
+                           &M_opponent_candidates );
+
+    for ( std::vector< int >::const_iterator i = M_opponent_candidates.begin();
+          i != M_opponent_candidates.end();
+          ++i )
     {
+        const OpponentCont::const_iterator o = M_opponents.begin() + *i;
         int step = predictOpponentReachStep( wm,
                                              *o,
-                                             first_ball_pos,
-                                             first_ball_vel,
+                                             ball_course,
                                              ball_move_angle,
                                              receive_point,
                                              std::min( max_cycle, min_step ) );
@@ -1601,8 +1633,7 @@ StrictCheckPassGenerator::predictOpponentsReachStep( const WorldModel & wm,
 int
 StrictCheckPassGenerator::predictOpponentReachStep( const WorldModel & wm,
                                                     const Opponent & opponent,
-                                                    const Vector2D & first_ball_pos,
-                                                    const Vector2D & first_ball_vel,
+                                                    const PredictBallCourse & ball_course,
                                                     const AngleDeg & ball_move_angle,
                                                     const Vector2D & receive_point,
                                                     const int max_cycle )
@@ -1615,6 +1646,9 @@ StrictCheckPassGenerator::predictOpponentReachStep( const WorldModel & wm,
 
     const ServerParam & SP = ServerParam::i();
 
+    const Vector2D & first_ball_pos = ball_course.firstPos();
+    const Vector2D & first_ball_vel = ball_course.firstVel();
+
     const PlayerType * ptype = opponent.player_->playerTypePtr();
     const int min_cycle = FieldAnalyzer::estimate_min_reach_cycle( opponent.pos_,
                                                                    ptype->realSpeedMax(),
@@ -1641,10 +1675,7 @@ StrictCheckPassGenerator::predictOpponentReachStep( const WorldModel & wm,
 
     for ( int cycle = std::max( 1, min_cycle ); cycle <= max_cycle; ++cycle )
     {
-        const Vector2D ball_pos = inertia_n_step_point( first_ball_pos,
-                                                        first_ball_vel,
-                                                        cycle,
-                                                        SP.ballDecay() );
+        const Vector2D ball_pos = ball_course.pos( cycle );
         const double control_area = ( opponent.player_->goalie()
                                       && penalty_area.contains( ball_pos )
                                       ? SP.catchableArea()
@@ -33,6 +33,7 @@
 #define STRICT_CHECK_PASS_GENERATOR_H
 
 #include "cooperative_action.h"
+#include "opponent_grid.h"
 
 #include <rcsc/player/abstract_player_object.h>
 #include <rcsc/geom/vector_2d.h>
@@ -40,6 +41,8 @@
 
 #include <vector>
 
+class PredictBallCourse;
+
 namespace rcsc {
 class PlayerObject;
 class WorldModel;
@@ -96,6 +99,8 @@ private:
 
     ReceiverCont M_receiver_candidates;
     OpponentCont M_opponents;
+    OpponentGrid M_opponent_grid; //!< spatial index of M_opponents
+    std::vector< int > M_opponent_candidates; //!< work area for grid queries
 
     int M_direct_size;
     int M_leading_size;
@@ -174,8 +179,7 @@ private:
                                    const rcsc::AbstractPlayerObject ** opponent );
     int predictOpponentReachStep( const rcsc::WorldModel & wm,
                                   const Opponent & opponent,
-                                  const rcsc::Vector2D & first_ball_pos,
-                                  const rcsc::Vector2D & first_ball_vel,
+                                  const PredictBallCourse & ball_course,
                                   const rcsc::AngleDeg & ball_move_angle,
                                   const rcsc::Vector2D & receive_point,
                                   const int max_cycle );
@@ -36,6 +36,7 @@
 #include "tackle_generator.h"
 
 #include "field_analyzer.h"
+#include "predict_ball_course.h"
 
 #include <rcsc/player/player_agent.h>
 #include <rcsc/common/logger.h>
@@ -641,6 +642,8 @@ TackleGenerator::predictOpponentsReachStep( const WorldModel & wm,
 #endif
 
     int min_step = first_min_step;
+    const PredictBallCourse ball_course( first_ball_pos, first_ball_vel, min_step );
+
     for ( AbstractPlayerCont::const_iterator
               o = wm.theirPlayers().begin(),
               end = wm.theirPlayers().end();
@@ -648,8 +651,7 @@ TackleGenerator::predictOpponentsReachStep( const WorldModel & wm,
           ++o )
     {
         int step = predictOpponentReachStep( *o,
-                                             first_ball_pos,
-                                             first_ball_vel,
+                                             ball_course,
                                              ball_move_angle,
                                              min_step );
         if ( step < min_step )
@@ -670,8 +672,7 @@ TackleGenerator::predictOpponentsReachStep( const WorldModel & wm,
  */
 int
 TackleGenerator::predictOpponentReachStep( const AbstractPlayerObject * opponent,
-                                           const Vector2D & first_ball_pos,
-                                           const Vector2D & first_ball_vel,
+                                           const PredictBallCourse & ball_course,
                                            const AngleDeg & ball_move_angle,
                                            const int max_cycle )
 {
@@ -682,7 +683,7 @@ TackleGenerator::predictOpponentReachStep( const AbstractPlayerObject * opponent
 
     int min_cycle = FieldAnalyzer::estimate_min_reach_cycle( opponent->pos(),
                                                              ptype->realSpeedMax(),
-                                                             first_ball_pos,
+                                                             ball_course.firstPos(),
                                                              ball_move_angle );
     if ( min_cycle < 0 )
     {
@@ -691,10 +692,7 @@ TackleGenerator::predictOpponentReachStep( const AbstractPlayerObject * opponent
 
     for ( int cycle = min_cycle; cycle < max_cycle; ++cycle )
     {
-        Vector2D ball_pos = inertia_n_step_point( first_ball_pos,
-                                                  first_ball_vel,
-                                                  cycle,
-                                                  SP.ballDecay() );
+        Vector2D ball_pos = ball_course.pos( cycle );
 
         if ( ball_pos.absX() > SP.pitchHalfLength()
              || ball_pos.absY() > SP.pitchHalfWidth() )
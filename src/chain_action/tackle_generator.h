@@ -37,6 +37,8 @@
 
 #include <vector>
 
+class PredictBallCourse;
+
 namespace rcsc {
 class AbstractPlayerObject;
 class WorldModel;
@@ -112,8 +114,7 @@ private:
                                    const rcsc::Vector2D & first_ball_vel,
                                    const rcsc::AngleDeg & ball_move_angle );
     int predictOpponentReachStep( const rcsc::AbstractPlayerObject * opponent,
-                                  const rcsc::Vector2D & first_ball_pos,
-                                  const rcsc::Vector2D & first_ball_vel,
+                                  const PredictBallCourse & ball_course,
                                   const rcsc::AngleDeg & ball_move_angle,
                                   const int max_cycle );
 
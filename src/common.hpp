@@ -49,7 +49,8 @@ enum status_t
   CAPTURED_BY_DEFENSE, // The defense has captured the ball
   OUT_OF_BOUNDS,       // Ball has gone out of bounds
   OUT_OF_TIME,         // Trial has ended due to time limit
-  SERVER_DOWN          // Server is not alive
+  SERVER_DOWN,         // Server is not alive
+  STEP_TIMEOUT         // No cycle arrived within the step timeout
 };
 
 // Configuration of the HFO domain including the team names and player
@@ -63,6 +64,15 @@ struct Config {
   std::vector<int> defense_nums; // Defensive player numbers
 };
 
+// Built-in rewards, see reward_function.h
+enum reward_t
+{
+  GOAL_REWARD,          // +1/-1 when the episode ends for/against the agent's team
+  BALL_PROGRESS_REWARD, // Meters the ball moved toward the goal attacked by the offense (negated on defense)
+  POSSESSION_REWARD,    // +1/-1 when the agent's team/the opponents gain the ball
+  PASS_REWARD           // +1 when a kick of the agent reaches a teammate
+};
+
 enum SideID {
   RIGHT = -1,
   NEUTRAL = 0,
@@ -75,6 +85,39 @@ struct Player {
   int unum;
 };
 
+// Action-chain planner counters of one behavior generator, accumulated
+// over the current episode. The last entry, named "total", covers the
+// whole planner; its best_count is the number of plans. Times are in
+// microseconds.
+struct PlannerStats {
+  std::string name;             // Generator name (e.g. "StrictCheckPass")
+  unsigned long calls;          // Number of generate calls
+  unsigned long generated;      // Number of generated candidates
+  unsigned long evaluated;      // Number of evaluated candidates
+  unsigned long best_count;     // Number of best chains ending with this generator
+  unsigned long best_depth_sum; // Sum of the best chain lengths
+  int best_depth_max;           // Longest best chain
+  double generate_usec;         // Time spent generating candidates
+  double evaluate_usec;         // Time spent evaluating candidates
+  double total_usec;            // Wall time of the planner ("total" only)
+};
+
+// Latencies of one phase of connectToServer() or step(), accumulated
+// since the environment was created or the last resetTimingStats().
+// Percentiles come from a histogram with about 3% resolution. Times are
+// in microseconds.
+struct TimingStats {
+  std::string name;    // Phase name (e.g. "receive")
+  unsigned long count; // Number of samples
+  double total_usec;   // Sum of the samples
+  double min_usec;
+  double max_usec;
+  double p50_usec;
+  double p90_usec;
+  double p99_usec;
+  double p999_usec;
+};
+
 /**
  * Returns the number of parameters required for each action.
  */
@@ -192,6 +235,8 @@ inline std::string StatusToString(status_t status) {
       return "OutOfTime";
     case SERVER_DOWN:
       return "ServerDown";
+    case STEP_TIMEOUT:
+      return "StepTimeout";
     default:
       return "Unknown";
   }
@@ -296,5 +341,26 @@ inline bool ParseGameStatus(const std::string& message, status_t& status) {
   return true;
 };
 
+/**
+ * Parse the trainer's answer to a game-state snapshot request:
+ * "HFO_SAVED <id> <team> <unum> <seq>", "HFO_RESTORED <id> <team> <unum>
+ * <seq>" or "HFO_DROPPED <id> <team> <unum> <seq>", where team, unum and
+ * seq identify the request and id is -1 if it failed.
+ */
+inline bool ParseStateReply(const std::string& message, bool& restored,
+                            int& id, std::string& team, int& unum, int& seq) {
+  std::istringstream iss(message);
+  std::string key;
+  iss >> key;
+  if (key.compare("HFO_SAVED") == 0 || key.compare("HFO_DROPPED") == 0) {
+    restored = false;
+  } else if (key.compare("HFO_RESTORED") == 0) {
+    restored = true;
+  } else {
+    return false;
+  }
+  return bool(iss >> id >> team >> unum >> seq);
+};
+
 }
 #endif
@@ -46,6 +46,7 @@
 
 #include "neck_default_intercept_neck.h"
 #include "neck_offensive_intercept_neck.h"
+#include "pooled.h"
 
 using namespace rcsc;
 
@@ -156,12 +157,12 @@ IntentionReceive::execute( PlayerAgent * agent )
 
         if ( opp_min >= self_min + 3 )
         {
-            agent->setNeckAction( new Neck_OffensiveInterceptNeck() );
+            agent->setNeckAction( new Pooled< Neck_OffensiveInterceptNeck >() );
         }
         else
         {
-            agent->setNeckAction( new Neck_DefaultInterceptNeck
-                                  ( new Neck_TurnToBallOrScan() ) );
+            agent->setNeckAction( new Pooled< Neck_DefaultInterceptNeck >
+                                  ( new Pooled< Neck_TurnToBallOrScan >() ) );
         }
 
         return true;
@@ -173,7 +174,7 @@ IntentionReceive::execute( PlayerAgent * agent )
                       __FILE__": execute. intercept cycle=%d",
                       self_min );
         agent->debugClient().addMessage( "IntentionRecv%d:Intercept", M_step );
-        agent->setNeckAction( new Neck_OffensiveInterceptNeck() );
+        agent->setNeckAction( new Pooled< Neck_OffensiveInterceptNeck >() );
         return true;
     }
 
@@ -189,7 +190,7 @@ IntentionReceive::execute( PlayerAgent * agent )
                     M_buffer,
                     M_dash_power
                     ).execute( agent );
-    agent->setNeckAction( new Neck_TurnToBallOrScan() );
+    agent->setNeckAction( new Pooled< Neck_TurnToBallOrScan >() );
 
     return true;
 }
@@ -0,0 +1,217 @@
+// -*-c++-*-
+
+// Renders rcg logs to videos without a display: frames are rasterized
+// in-process and piped raw to an encoder, several logs at a time.
+//
+//   > ./bin/rcg_render -j 8 -d videos log/*.rcg
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "rcg_renderer.h"
+
+#include <rcsc/gz.h>
+
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Options {
+  int width, height, fps, jobs;
+  bool half_field;
+  bool raw;             // Write the frames of a single log to stdout
+  std::string out;      // Video of a single log
+  std::string out_dir;  // Directory of the videos, next to the logs if empty
+  std::string encoder;  // Encoder command; {size}, {fps} and {out} are substituted
+  std::vector<std::string> logs;
+};
+
+const char* DEFAULT_ENCODER =
+    "ffmpeg -loglevel error -y -f rawvideo -pix_fmt rgb24 -s {size} -r {fps}"
+    " -i - -c:v libx264 -pix_fmt yuv420p -threads 1 {out}";
+
+void usage() {
+  std::cerr <<
+      "usage: rcg_render [options] log.rcg[.gz] ...\n"
+      "  -o FILE       video of the single log given\n"
+      "  -d DIR        directory of the videos (default: next to each log)\n"
+      "  -j N          logs rendered in parallel (default: number of cores)\n"
+      "  -s WxH        frame size, even (default: 1024x768)\n"
+      "  -r FPS        frame rate (default: 10, real time)\n"
+      "  --full        show the whole pitch, not the half played in HFO\n"
+      "  --raw         write raw RGB24 frames of the single log to stdout\n"
+      "  --encoder CMD encoder reading raw RGB24 frames on its stdin, with\n"
+      "                {size}, {fps} and {out} substituted (default: ffmpeg)\n";
+}
+
+bool parseOptions(int argc, char** argv, Options& opt) {
+  opt.width = 1024;
+  opt.height = 768;
+  opt.fps = 10;
+  opt.jobs = std::max(1u, std::thread::hardware_concurrency());
+  opt.half_field = true;
+  opt.raw = false;
+  opt.encoder = DEFAULT_ENCODER;
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    const bool has_value = i + 1 < argc;
+    if (arg == "-o" && has_value) {
+      opt.out = argv[++i];
+    } else if (arg == "-d" && has_value) {
+      opt.out_dir = argv[++i];
+    } else if (arg == "-j" && has_value) {
+      opt.jobs = std::max(1, std::atoi(argv[++i]));
+    } else if (arg == "-s" && has_value) {
+      if (std::sscanf(argv[++i], "%dx%d", &opt.width, &opt.height) != 2) {
+        return false;
+      }
+    } else if (arg == "-r" && has_value) {
+      opt.fps = std::atoi(argv[++i]);
+    } else if (arg == "--full") {
+      opt.half_field = false;
+    } else if (arg == "--raw") {
+      opt.raw = true;
+    } else if (arg == "--encoder" && has_value) {
+      opt.encoder = argv[++i];
+    } else if (!arg.empty() && arg[0] == '-') {
+      return false;
+    } else {
+      opt.logs.push_back(arg);
+    }
+  }
+  if (opt.logs.empty() || opt.width <= 0 || opt.height <= 0
+      || opt.width % 2 || opt.height % 2 || opt.fps <= 0) {
+    return false;
+  }
+  if ((opt.raw || !opt.out.empty()) && opt.logs.size() != 1) {
+    std::cerr << "-o and --raw take a single log" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+void replaceAll(std::string& s, const std::string& key, const std::string& value) {
+  for (size_t pos = s.find(key); pos != std::string::npos;
+       pos = s.find(key, pos + value.size())) {
+    s.replace(pos, key.size(), value);
+  }
+}
+
+// Single-quoted for the shell, with embedded quotes as '\''
+std::string shellQuote(const std::string& s) {
+  std::string quoted = s;
+  replaceAll(quoted, "'", "'\\''");
+  return "'" + quoted + "'";
+}
+
+// log/2016-01-01.rcg.gz -> DIR/2016-01-01.mp4
+std::string videoPath(const Options& opt, const std::string& log) {
+  if (!opt.out.empty()) {
+    return opt.out;
+  }
+  std::string name = log;
+  const char* suffixes[] = {".gz", ".rcg"};
+  for (int i = 0; i < 2; ++i) {
+    const size_t len = std::strlen(suffixes[i]);
+    if (name.size() > len && name.compare(name.size() - len, len, suffixes[i]) == 0) {
+      name.erase(name.size() - len);
+    }
+  }
+  if (!opt.out_dir.empty()) {
+    const size_t slash = name.rfind('/');
+    name = opt.out_dir + "/" + (slash == std::string::npos ? name : name.substr(slash + 1));
+  }
+  return name + ".mp4";
+}
+
+// Returns false on failure
+bool render(const Options& opt, const std::string& log) {
+  rcsc::gzifstream fin(log.c_str());
+  if (!fin.is_open()) {
+    std::cerr << log << ": cannot open" << std::endl;
+    return false;
+  }
+  rcsc::rcg::Parser::Ptr parser = rcsc::rcg::Parser::create(fin);
+  if (!parser) {
+    std::cerr << log << ": not an rcg log" << std::endl;
+    return false;
+  }
+
+  const std::string video = videoPath(opt, log);
+  std::FILE* out = stdout;
+  if (!opt.raw) {
+    std::string cmd = opt.encoder;
+    std::ostringstream size, fps;
+    size << opt.width << "x" << opt.height;
+    fps << opt.fps;
+    replaceAll(cmd, "{size}", size.str());
+    replaceAll(cmd, "{fps}", fps.str());
+    replaceAll(cmd, "{out}", shellQuote(video));
+    out = popen(cmd.c_str(), "w");
+    if (out == NULL) {
+      std::cerr << log << ": cannot start the encoder: " << cmd << std::endl;
+      return false;
+    }
+  }
+
+  RcgRenderer renderer(opt.width, opt.height, opt.half_field, out);
+  parser->parse(fin, renderer);
+  bool ok = renderer.ok();
+  if (opt.raw) {
+    ok = std::fflush(out) == 0 && ok;
+  } else {
+    ok = pclose(out) == 0 && ok;
+  }
+  if (!ok) {
+    std::cerr << log << ": rendering failed after "
+              << renderer.framesWritten() << " frames" << std::endl;
+  } else if (!opt.raw) {
+    std::cerr << log << ": " << renderer.framesWritten() << " frames to "
+              << video << std::endl;
+  }
+  return ok;
+}
+
+}
+
+int
+main(int argc, char** argv)
+{
+  Options opt;
+  if (!parseOptions(argc, argv, opt)) {
+    usage();
+    return EXIT_FAILURE;
+  }
+  // A failed encoder must not kill the other renderings
+  std::signal(SIGPIPE, SIG_IGN);
+
+  // Each worker renders whole logs, with its own canvases and encoder
+  std::atomic<size_t> next(0);
+  std::atomic<int> failures(0);
+  std::vector<std::thread> workers;
+  const int jobs = std::min<size_t>(opt.jobs, opt.logs.size());
+  for (int j = 0; j < jobs; ++j) {
+    workers.push_back(std::thread([&]() {
+      for (size_t i = next++; i < opt.logs.size(); i = next++) {
+        if (!render(opt, opt.logs[i])) {
+          ++failures;
+        }
+      }
+    }));
+  }
+  for (size_t j = 0; j < workers.size(); ++j) {
+    workers[j].join();
+  }
+  return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
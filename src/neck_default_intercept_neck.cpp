@@ -38,6 +38,7 @@
 #include "action_chain_graph.h"
 #include "action_chain_holder.h"
 #include "cooperative_action.h"
+#include "pooled.h"
 
 #include <rcsc/action/neck_turn_to_point.h>
 #include <rcsc/action/neck_turn_to_ball_and_player.h>
@@ -203,11 +204,11 @@ Neck_DefaultInterceptNeck::doTurnToReceiver( PlayerAgent * agent )
 NeckAction *
 Neck_DefaultInterceptNeck::clone() const
 {
-    return new Neck_DefaultInterceptNeck( M_chain_graph,
-                                          ( M_default_view_act
-                                            ? M_default_view_act->clone()
-                                            : static_cast< ViewAction * >( 0 ) ),
-                                          ( M_default_neck_act
-                                            ? M_default_neck_act->clone()
-                                            : static_cast< NeckAction * >( 0 ) ) );
+    return new Pooled< Neck_DefaultInterceptNeck >( M_chain_graph,
+                                                    ( M_default_view_act
+                                                      ? M_default_view_act->clone()
+                                                      : static_cast< ViewAction * >( 0 ) ),
+                                                    ( M_default_neck_act
+                                                      ? M_default_neck_act->clone()
+                                                      : static_cast< NeckAction * >( 0 ) ) );
 }
@@ -53,6 +53,7 @@
 #include <rcsc/action/view_synch.h>
 
 #include "neck_default_intercept_neck.h"
+#include "pooled.h"
 
 using namespace rcsc;
 
@@ -128,7 +129,7 @@ Neck_OffensiveInterceptNeck::execute( PlayerAgent * agent )
             dlog.addText( Logger::TEAM,
                           __FILE__": set wide. trap_ball_speed=%.3f",
                           trap_ball_speed );
-            view = new View_Wide();
+            view = new Pooled< View_Wide >();
         }
     }
 
@@ -138,7 +139,7 @@ Neck_OffensiveInterceptNeck::execute( PlayerAgent * agent )
         if ( wm.ball().seenPosCount() <= 1
              || trap_ball_speed < wm.self().playerType().kickableArea() )
         {
-            view = new View_Normal();
+            view = new Pooled< View_Normal >();
             dlog.addText( Logger::TEAM,
                           __FILE__": set normal. trap_ball_speed=%.3f",
                           trap_ball_speed );
@@ -150,7 +151,7 @@ Neck_OffensiveInterceptNeck::execute( PlayerAgent * agent )
          && self_min >= 4
          && angle_diff > ViewWidth::width( ViewWidth::NORMAL ) * 0.5 - 3.0 )
     {
-        view = new View_Wide();
+        view = new Pooled< View_Wide >();
         dlog.addText( Logger::TEAM,
                       __FILE__": set wide for ball check" );
     }
@@ -160,7 +161,7 @@ Neck_OffensiveInterceptNeck::execute( PlayerAgent * agent )
          && self_min >= 3
          && angle_diff > ViewWidth::width( ViewWidth::NARROW ) * 0.5 - 3.0 )
     {
-        view = new View_Normal();
+        view = new Pooled< View_Normal >();
         dlog.addText( Logger::TEAM,
                       __FILE__": set normal for ball check" );
     }
@@ -169,19 +170,19 @@ Neck_OffensiveInterceptNeck::execute( PlayerAgent * agent )
     {
         if ( self_min > 15 )
         {
-            view = new View_Normal();
+            view = new Pooled< View_Normal >();
             dlog.addText( Logger::TEAM,
                           __FILE__": set wide (2)" );
         }
         else if ( self_min > 10 )
         {
-            view = new View_Normal();
+            view = new Pooled< View_Normal >();
             dlog.addText( Logger::TEAM,
                           __FILE__": set normal (2)" );
         }
         else if ( self_min <= 6 )
         {
-            view = new View_Synch();
+            view = new Pooled< View_Synch >();
             dlog.addText( Logger::TEAM,
                           __FILE__": set synch" );
         }
@@ -212,7 +213,7 @@ Neck_OffensiveInterceptNeck::execute( PlayerAgent * agent )
         dlog.addText( Logger::TEAM,
                       __FILE__": look ball" );
         Neck_DefaultInterceptNeck( view,
-                                   new Neck_TurnToBall() ).execute( agent );
+                                   new Pooled< Neck_TurnToBall >() ).execute( agent );
     }
     else if ( next_ball_pos.x > 34.0
               && next_ball_pos.absY() < 17.0
@@ -236,7 +237,7 @@ Neck_OffensiveInterceptNeck::execute( PlayerAgent * agent )
                       count_thr );
 
         Neck_DefaultInterceptNeck( view,
-                                   new Neck_TurnToGoalieOrScan( count_thr ) ).execute( agent );
+                                   new Pooled< Neck_TurnToGoalieOrScan >( count_thr ) ).execute( agent );
 
     }
     //else if ( ball_in_visible )
@@ -246,7 +247,7 @@ Neck_OffensiveInterceptNeck::execute( PlayerAgent * agent )
         dlog.addText( Logger::TEAM,
                       __FILE__": default neck: low conf teammate" );
         Neck_DefaultInterceptNeck( view,
-                                   new Neck_TurnToLowConfTeammate() ).execute( agent );
+                                   new Pooled< Neck_TurnToLowConfTeammate >() ).execute( agent );
     }
     // TODO:
     // else if ( self_min == 5 && can_look_ball_with_current_view )
@@ -268,7 +269,7 @@ Neck_OffensiveInterceptNeck::execute( PlayerAgent * agent )
         }
 
         Neck_DefaultInterceptNeck( view,
-                                   new Neck_TurnToBallOrScan( count_thr ) ).execute( agent );
+                                   new Pooled< Neck_TurnToBallOrScan >( count_thr ) ).execute( agent );
     }
 
     return true;
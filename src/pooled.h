@@ -0,0 +1,138 @@
+// -*-c++-*-
+
+/*!
+  \file pooled.h
+  \brief free-list allocation of per-cycle command objects Header File
+*/
+
+/////////////////////////////////////////////////////////////////////
+
+#ifndef POOLED_H
+#define POOLED_H
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+/*!
+  \class PoolStats
+  \brief heap allocations made by all pools of the current thread
+*/
+class PoolStats {
+public:
+
+    /*!
+      \brief number of blocks the pools of this thread took from the heap.
+      constant once the agent reached its steady state, except on __APPLE__
+      where the pools are disabled and every allocation is counted.
+     */
+    static
+    unsigned long & heap_allocations()
+      {
+#ifdef __APPLE__
+          static unsigned long s_count = 0;
+#else
+          static thread_local unsigned long s_count = 0;
+#endif
+          return s_count;
+      }
+};
+
+/*!
+  \class Pooled
+  \brief T, allocated from a per-thread free list of T sized blocks.
+
+  Views, necks, intentions and say messages are handed to
+  rcsc::PlayerAgent every cycle, which deletes them after use. Creating
+  them as "new Pooled< T >( args )" instead of "new T( args )" keeps the
+  ownership unchanged, but a delete returns the block to the free list,
+  so that steady-state cycles reuse blocks instead of calling the heap.
+  T must have a virtual destructor if it is deleted through a base.
+
+  On __APPLE__, without thread_local, a shared free list would race
+  between the agents of thread_agents, so blocks go straight to the heap.
+ */
+template < typename T >
+class Pooled
+    : public T {
+private:
+
+#ifndef __APPLE__
+    struct Block {
+        Block * next_;
+    };
+
+    struct FreeList {
+        Block * head_;
+
+        FreeList()
+            : head_( static_cast< Block * >( 0 ) )
+          { }
+
+        ~FreeList()
+          {
+              while ( head_ )
+              {
+                  Block * next = head_->next_;
+                  ::operator delete( head_ );
+                  head_ = next;
+              }
+          }
+    };
+
+    static
+    FreeList & free_list()
+      {
+          static thread_local FreeList s_list;
+          return s_list;
+      }
+#endif
+
+public:
+
+    template < typename... Args >
+    explicit
+    Pooled( Args &&... args )
+        : T( std::forward< Args >( args )... )
+      { }
+
+    static
+    void * operator new( std::size_t size )
+      {
+#ifdef __APPLE__
+          ++PoolStats::heap_allocations();
+          return ::operator new( size );
+#else
+          FreeList & list = free_list();
+          if ( list.head_ && size <= sizeof( Pooled ) )
+          {
+              Block * block = list.head_;
+              list.head_ = block->next_;
+              return block;
+          }
+
+          ++PoolStats::heap_allocations();
+          return ::operator new( size < sizeof( Block ) ? sizeof( Block ) : size );
+#endif
+      }
+
+    static
+    void operator delete( void * ptr )
+      {
+          if ( ! ptr )
+          {
+              return;
+          }
+
+#ifdef __APPLE__
+          ::operator delete( ptr );
+#else
+          Block * block = static_cast< Block * >( ptr );
+          FreeList & list = free_list();
+          block->next_ = list.head_;
+          list.head_ = block;
+#endif
+      }
+};
+
+#endif
@@ -0,0 +1,220 @@
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "rcg_renderer.h"
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+using namespace rcsc;
+
+namespace {
+
+// Standard pitch dimensions, in meters
+const double PITCH_HALF_LENGTH = 52.5;
+const double PITCH_HALF_WIDTH = 34.0;
+const double PITCH_MARGIN = 3.0;
+const double PENALTY_AREA_LENGTH = 16.5;
+const double PENALTY_AREA_HALF_WIDTH = 20.16;
+const double GOAL_AREA_LENGTH = 5.5;
+const double GOAL_AREA_HALF_WIDTH = 9.16;
+const double GOAL_HALF_WIDTH = 7.01;
+const double GOAL_DEPTH = 2.44;
+const double CENTER_CIRCLE_R = 9.15;
+const double PENALTY_SPOT_DIST = 11.0;
+// Drawn sizes, larger than the bodies for legibility
+const double PLAYER_R = 1.0;
+const double BALL_R = 0.5;
+
+const Canvas::Color GRASS = {31, 140, 31};
+const Canvas::Color LINE = {255, 255, 255};
+const Canvas::Color GOAL = {40, 40, 40};
+const Canvas::Color LEFT_PLAYER = {255, 215, 0};
+const Canvas::Color LEFT_GOALIE = {0, 200, 200};
+const Canvas::Color RIGHT_PLAYER = {220, 40, 40};
+const Canvas::Color RIGHT_GOALIE = {200, 0, 200};
+const Canvas::Color OUTLINE = {0, 0, 0};
+const Canvas::Color BALL = {255, 255, 255};
+
+}
+
+RcgRenderer::RcgRenderer(int width, int height, bool half_field,
+                         std::FILE* out) :
+  pitch(width, height),
+  frame(width, height),
+  out(out),
+  rotated(half_field),
+  score_l(0),
+  score_r(0),
+  frames(0),
+  write_error(false)
+{
+  min_x = half_field ? -PITCH_MARGIN : -PITCH_HALF_LENGTH - PITCH_MARGIN;
+  max_x = PITCH_HALF_LENGTH + PITCH_MARGIN;
+  min_y = -PITCH_HALF_WIDTH - PITCH_MARGIN;
+  max_y = PITCH_HALF_WIDTH + PITCH_MARGIN;
+  // Fit the field, centered
+  const double field_w = rotated ? max_y - min_y : max_x - min_x;
+  const double field_h = rotated ? max_x - min_x : max_y - min_y;
+  scale = std::min(width / field_w, height / field_h);
+  offset_x = (width - field_w * scale) / 2;
+  offset_y = (height - field_h * scale) / 2;
+  drawPitch();
+}
+
+void RcgRenderer::toScreen(double x, double y, double& sx, double& sy) const {
+  // Rotated a quarter turn clockwise, as soccerwindow2 frames used to be
+  if (rotated) {
+    sx = offset_x + (max_y - y) * scale;
+    sy = offset_y + (x - min_x) * scale;
+  } else {
+    sx = offset_x + (x - min_x) * scale;
+    sy = offset_y + (y - min_y) * scale;
+  }
+}
+
+void RcgRenderer::line(double x0, double y0, double x1, double y1,
+                       double thickness, Canvas::Color c) {
+  double sx0, sy0, sx1, sy1;
+  toScreen(x0, y0, sx0, sy0);
+  toScreen(x1, y1, sx1, sy1);
+  pitch.drawLine(sx0, sy0, sx1, sy1, thickness, c);
+}
+
+void RcgRenderer::rect(double x0, double y0, double x1, double y1,
+                       Canvas::Color c) {
+  double sx0, sy0, sx1, sy1;
+  toScreen(x0, y0, sx0, sy0);
+  toScreen(x1, y1, sx1, sy1);
+  pitch.fillRect(std::min(sx0, sx1), std::min(sy0, sy1),
+                 std::max(sx0, sx1), std::max(sy0, sy1), c);
+}
+
+void RcgRenderer::drawPitch() {
+  const double t = std::max(1.0, 0.12 * scale); // Line thickness
+  const double L = PITCH_HALF_LENGTH;
+  const double W = PITCH_HALF_WIDTH;
+  double sx, sy;
+  pitch.fill(GRASS);
+  // Outline and center line
+  line(-L, -W, L, -W, t, LINE);
+  line(-L, W, L, W, t, LINE);
+  line(-L, -W, -L, W, t, LINE);
+  line(L, -W, L, W, t, LINE);
+  line(0, -W, 0, W, t, LINE);
+  toScreen(0, 0, sx, sy);
+  pitch.drawCircle(sx, sy, CENTER_CIRCLE_R * scale, t, LINE);
+  pitch.fillCircle(sx, sy, t, LINE);
+  for (int side = -1; side <= 1; side += 2) {
+    const double goal_x = side * L;
+    // Penalty and goal areas
+    const double areas[2][2] = {
+      {PENALTY_AREA_LENGTH, PENALTY_AREA_HALF_WIDTH},
+      {GOAL_AREA_LENGTH, GOAL_AREA_HALF_WIDTH}
+    };
+    for (int i = 0; i < 2; ++i) {
+      const double x = goal_x - side * areas[i][0];
+      const double hw = areas[i][1];
+      line(goal_x, -hw, x, -hw, t, LINE);
+      line(goal_x, hw, x, hw, t, LINE);
+      line(x, -hw, x, hw, t, LINE);
+    }
+    toScreen(goal_x - side * PENALTY_SPOT_DIST, 0, sx, sy);
+    pitch.fillCircle(sx, sy, t, LINE);
+    // Goal
+    rect(goal_x, -GOAL_HALF_WIDTH, goal_x + side * GOAL_DEPTH,
+         GOAL_HALF_WIDTH, GOAL);
+  }
+}
+
+bool RcgRenderer::handleShow(const rcg::ShowInfoT& show) {
+  if (write_error) {
+    return false;
+  }
+  frame.copy(pitch);
+  const double r = std::max(4.0, PLAYER_R * scale);
+  const int digit_scale = std::max(1, (int) (r / 6));
+  for (int i = 0; i < rcsc::MAX_PLAYER * 2; ++i) {
+    const rcg::PlayerT& p = show.player_[i];
+    if (!p.isAlive()) {
+      continue;
+    }
+    const bool left = p.side() == rcsc::LEFT;
+    const Canvas::Color color = p.isGoalie()
+        ? (left ? LEFT_GOALIE : RIGHT_GOALIE)
+        : (left ? LEFT_PLAYER : RIGHT_PLAYER);
+    const double body = p.body_ * M_PI / 180.0;
+    double x, y, front_x, front_y;
+    toScreen(p.x_, p.y_, x, y);
+    toScreen(p.x_ + r / scale * std::cos(body), p.y_ + r / scale * std::sin(body),
+             front_x, front_y);
+    frame.fillCircle(x, y, r + 1, OUTLINE);
+    frame.fillCircle(x, y, r, color);
+    frame.drawLine(x, y, front_x, front_y, std::max(1.0, r / 5), OUTLINE);
+    std::ostringstream unum;
+    unum << p.unum_;
+    const int text_w = Canvas::textWidth(unum.str(), digit_scale);
+    frame.drawText((int) (x - text_w / 2.0), (int) (y - 2.5 * digit_scale),
+                   unum.str(), digit_scale, OUTLINE);
+  }
+  const double ball_r = std::max(3.0, BALL_R * scale);
+  double ball_x, ball_y;
+  toScreen(show.ball_.x_, show.ball_.y_, ball_x, ball_y);
+  frame.fillCircle(ball_x, ball_y, ball_r + 1, OUTLINE);
+  frame.fillCircle(ball_x, ball_y, ball_r, BALL);
+
+  // Cycle on the top left, score on the top right
+  const int text_scale = std::max(2, frame.height() / 150);
+  const int margin = text_scale * 2;
+  std::ostringstream cycle, score_l_text, score_r_text;
+  cycle << show.time_;
+  score_l_text << score_l;
+  score_r_text << score_r;
+  frame.drawText(margin, margin, cycle.str(), text_scale, LINE);
+  const std::string dash = "-";
+  int x = frame.width() - margin
+      - Canvas::textWidth(score_l_text.str() + dash + score_r_text.str(),
+                          text_scale);
+  x += frame.drawText(x, margin, score_l_text.str(), text_scale, LEFT_PLAYER);
+  x += frame.drawText(x, margin, dash, text_scale, LINE);
+  frame.drawText(x, margin, score_r_text.str(), text_scale, RIGHT_PLAYER);
+
+  if (std::fwrite(frame.data(), 1, frame.size(), out) != frame.size()) {
+    write_error = true;
+    return false;
+  }
+  ++frames;
+  return true;
+}
+
+bool RcgRenderer::handleTeam(const int, const rcg::TeamT& team_l,
+                             const rcg::TeamT& team_r) {
+  score_l = team_l.score_;
+  score_r = team_r.score_;
+  return true;
+}
+
+bool RcgRenderer::handleMsg(const int, const int, const std::string&) {
+  return true;
+}
+
+bool RcgRenderer::handleDraw(const int, const rcg::drawinfo_t&) {
+  return true;
+}
+
+bool RcgRenderer::handlePlayMode(const int, const PlayMode) {
+  return true;
+}
+
+bool RcgRenderer::handleServerParam(const std::string&) {
+  return true;
+}
+
+bool RcgRenderer::handlePlayerParam(const std::string&) {
+  return true;
+}
+
+bool RcgRenderer::handlePlayerType(const std::string&) {
+  return true;
+}
@@ -0,0 +1,55 @@
+// -*-c++-*-
+
+#ifndef RCG_RENDERER_H
+#define RCG_RENDERER_H
+
+#include <rcsc/rcg.h>
+#include <cstdio>
+#include <string>
+#include "canvas.h"
+
+/**
+ * Renders the shows of an rcg log, as they are parsed, into raw RGB24
+ * frames written to out, e.g. the stdin of a video encoder. The pitch is
+ * drawn once; each frame copies it and adds the players, the ball, the
+ * cycle and the score.
+ */
+class RcgRenderer : public rcsc::rcg::Handler {
+public:
+  // half_field: only show the half attacked by the offense (the left
+  // team), as HFO is played, with the goal at the bottom
+  RcgRenderer(int width, int height, bool half_field, std::FILE* out);
+
+  inline long framesWritten() const { return frames; }
+  // False once writing a frame failed, e.g. the encoder exited
+  inline bool ok() const { return !write_error; }
+
+  virtual bool handleShow(const rcsc::rcg::ShowInfoT& show);
+  virtual bool handleMsg(const int time, const int board, const std::string& msg);
+  virtual bool handleDraw(const int time, const rcsc::rcg::drawinfo_t& draw);
+  virtual bool handlePlayMode(const int time, const rcsc::PlayMode pm);
+  virtual bool handleTeam(const int time, const rcsc::rcg::TeamT& team_l,
+                          const rcsc::rcg::TeamT& team_r);
+  virtual bool handleServerParam(const std::string& msg);
+  virtual bool handlePlayerParam(const std::string& msg);
+  virtual bool handlePlayerType(const std::string& msg);
+
+private:
+  // Field coordinates in meters to pixels
+  void toScreen(double x, double y, double& sx, double& sy) const;
+  void line(double x0, double y0, double x1, double y1, double thickness,
+            Canvas::Color c);
+  void rect(double x0, double y0, double x1, double y1, Canvas::Color c);
+  void drawPitch();
+
+  Canvas pitch;  // Background, drawn once
+  Canvas frame;  // Current frame
+  std::FILE* out;
+  bool rotated;  // Field x points down instead of right
+  double min_x, max_x, min_y, max_y, scale, offset_x, offset_y;
+  int score_l, score_r;
+  long frames;
+  bool write_error;
+};
+
+#endif // RCG_RENDERER_H
@@ -0,0 +1,139 @@
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "reward_function.h"
+#include <rcsc/common/server_param.h>
+
+using namespace rcsc;
+using namespace hfo;
+
+RewardFunction::RewardFunction() {}
+
+RewardFunction::~RewardFunction() {}
+
+void RewardFunction::reset() {}
+
+bool RewardFunction::playingOffense(const WorldModel& wm) {
+  return wm.ourSide() == rcsc::LEFT;
+}
+
+GoalReward::GoalReward() : paid(false) {}
+
+float GoalReward::computeReward(const WorldModel& wm, status_t status) {
+  if (status == IN_GAME || status == SERVER_DOWN || paid) {
+    return 0;
+  }
+  paid = true;
+  float reward = 0;
+  if (status == GOAL) {
+    reward = 1;
+  } else if (status == CAPTURED_BY_DEFENSE || status == OUT_OF_BOUNDS) {
+    reward = -1;
+  }
+  return playingOffense(wm) ? reward : -reward;
+}
+
+void GoalReward::reset() {
+  paid = false;
+}
+
+BallProgressReward::BallProgressReward() : lastBallDist(-1) {}
+
+float BallProgressReward::computeReward(const WorldModel& wm, status_t status) {
+  if (status != IN_GAME || !wm.ball().posValid()) {
+    return 0;
+  }
+  // The world model is in the agent's coordinates, its own goal at -x
+  const ServerParam& SP = ServerParam::i();
+  bool offense = playingOffense(wm);
+  const Vector2D goal = offense ? SP.theirTeamGoalPos() : SP.ourTeamGoalPos();
+  float dist = wm.ball().pos().dist(goal);
+  float reward = 0;
+  if (lastBallDist >= 0) {
+    reward = offense ? lastBallDist - dist : dist - lastBallDist;
+  }
+  lastBallDist = dist;
+  return reward;
+}
+
+void BallProgressReward::reset() {
+  lastBallDist = -1;
+}
+
+PossessionReward::PossessionReward() : owner(0) {}
+
+float PossessionReward::computeReward(const WorldModel& wm, status_t status) {
+  if (status != IN_GAME) {
+    return 0;
+  }
+  bool ours = wm.self().isKickable() || wm.existKickableTeammate();
+  bool theirs = wm.existKickableOpponent();
+  if (ours == theirs) {
+    return 0; // Loose or contested
+  }
+  int new_owner = ours ? 1 : -1;
+  if (new_owner == owner) {
+    return 0;
+  }
+  owner = new_owner;
+  return new_owner;
+}
+
+void PossessionReward::reset() {
+  owner = 0;
+}
+
+PassReward::PassReward() : wasKickable(false), passing(false) {}
+
+float PassReward::computeReward(const WorldModel& wm, status_t status) {
+  if (status != IN_GAME) {
+    return 0;
+  }
+  bool kickable = wm.self().isKickable();
+  float reward = 0;
+  if (kickable || wm.existKickableOpponent()) {
+    passing = false;
+  } else if (wm.existKickableTeammate()) {
+    if (passing || wasKickable) {
+      reward = 1;
+    }
+    passing = false;
+  } else if (wasKickable) {
+    passing = true;
+  }
+  wasKickable = kickable;
+  return reward;
+}
+
+void PassReward::reset() {
+  wasKickable = false;
+  passing = false;
+}
+
+RewardSum::RewardSum() {}
+
+RewardSum::~RewardSum() {
+  for (size_t i = 0; i < rewards.size(); ++i) {
+    delete rewards[i];
+  }
+}
+
+void RewardSum::add(RewardFunction* reward, float weight) {
+  rewards.push_back(reward);
+  weights.push_back(weight);
+}
+
+float RewardSum::computeReward(const WorldModel& wm, status_t status) {
+  float reward = 0;
+  for (size_t i = 0; i < rewards.size(); ++i) {
+    reward += weights[i] * rewards[i]->computeReward(wm, status);
+  }
+  return reward;
+}
+
+void RewardSum::reset() {
+  for (size_t i = 0; i < rewards.size(); ++i) {
+    rewards[i]->reset();
+  }
+}
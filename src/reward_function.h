@@ -0,0 +1,114 @@
+// -*-c++-*-
+
+#ifndef REWARD_FUNCTION_H
+#define REWARD_FUNCTION_H
+
+#include <rcsc/player/world_model.h>
+#include "common.hpp"
+#include <vector>
+
+/**
+ * A reward computed by the agent every cycle from the world model, so
+ * that clients receive it with the state features instead of
+ * reconstructing it from them. Implementations may keep values of the
+ * previous cycle; reset() is called when a new episode begins.
+ */
+class RewardFunction {
+public:
+  RewardFunction();
+  virtual ~RewardFunction();
+
+  // Returns the reward of the current cycle
+  virtual float computeReward(const rcsc::WorldModel& wm,
+                              hfo::status_t status) = 0;
+
+  // Forget the previous cycles at the start of an episode
+  virtual void reset();
+
+protected:
+  // Is the agent's team the offense?
+  static bool playingOffense(const rcsc::WorldModel& wm);
+};
+
+/**
+ * +1 when the episode ends in favor of the agent's team, -1 when it ends
+ * against it, 0 when it runs out of time. Paid once per episode.
+ */
+class GoalReward : public RewardFunction {
+public:
+  GoalReward();
+  virtual float computeReward(const rcsc::WorldModel& wm,
+                              hfo::status_t status);
+  virtual void reset();
+
+private:
+  bool paid;
+};
+
+/**
+ * Meters the ball moved toward the goal attacked by the offense since the
+ * previous cycle, negated for the defense.
+ */
+class BallProgressReward : public RewardFunction {
+public:
+  BallProgressReward();
+  virtual float computeReward(const rcsc::WorldModel& wm,
+                              hfo::status_t status);
+  virtual void reset();
+
+private:
+  float lastBallDist; // Negative until the ball has been seen
+};
+
+/**
+ * +1 when the agent's team gains the ball, -1 when the opponents do.
+ * A loose ball stays with its last owner.
+ */
+class PossessionReward : public RewardFunction {
+public:
+  PossessionReward();
+  virtual float computeReward(const rcsc::WorldModel& wm,
+                              hfo::status_t status);
+  virtual void reset();
+
+private:
+  int owner; // 1: our team, -1: opponents, 0: nobody yet
+};
+
+/**
+ * +1 when the ball, after leaving the agent, is next controlled by a
+ * teammate.
+ */
+class PassReward : public RewardFunction {
+public:
+  PassReward();
+  virtual float computeReward(const rcsc::WorldModel& wm,
+                              hfo::status_t status);
+  virtual void reset();
+
+private:
+  bool wasKickable; // Was the ball kickable by the agent last cycle?
+  bool passing;     // Has the ball left the agent, not yet controlled?
+};
+
+/**
+ * Weighted sum of reward functions, which it owns.
+ */
+class RewardSum : public RewardFunction {
+public:
+  RewardSum();
+  virtual ~RewardSum();
+
+  void add(RewardFunction* reward, float weight);
+  inline bool empty() const { return rewards.empty(); }
+
+  virtual float computeReward(const rcsc::WorldModel& wm,
+                              hfo::status_t status);
+  virtual void reset();
+
+private:
+  std::vector<RewardFunction*> rewards;
+  std::vector<float> weights;
+};
+
+#endif // REWARD_FUNCTION_H
@@ -33,6 +33,7 @@
 #include "bhv_goalie_basic_move.h"
 #include "bhv_goalie_chase_ball.h"
 #include "bhv_goalie_free_kick.h"
+#include "pooled.h"
 
 #include <rcsc/action/basic_actions.h>
 #include <rcsc/action/neck_scan_field.h>
@@ -85,7 +86,7 @@ RoleGoalie::execute( PlayerAgent * agent )
                       agent->world().ball().distFromSelf(),
                       ServerParam::i().catchableArea() );
         agent->doCatch();
-        agent->setNeckAction( new Neck_TurnToBall() );
+        agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
     }
     else if ( agent->world().self().isKickable() )
     {
@@ -107,7 +108,7 @@ void
 RoleGoalie::doKick( PlayerAgent * agent )
 {
     Body_ClearBall().execute( agent );
-    agent->setNeckAction( new Neck_ScanField() );
+    agent->setNeckAction( new Pooled< Neck_ScanField >() );
 }
 
 /*-------------------------------------------------------------------*/
@@ -33,6 +33,7 @@
 #include "strategy.h"
 
 #include "bhv_chain_action.h"
+#include "pooled.h"
 
 #include <rcsc/action/body_go_to_point.h>
 #include <rcsc/action/body_intercept.h>
@@ -121,7 +122,7 @@ RoleKeepawayKeeper::doMove( PlayerAgent * agent )
     {
         Vector2D face_point( 0.0, 0.0 );
         Body_Intercept( true, face_point ).execute( agent );
-        agent->setNeckAction( new Neck_TurnToBallOrScan() );
+        agent->setNeckAction( new Pooled< Neck_TurnToBallOrScan >() );
         return;
     }
 
@@ -135,5 +136,5 @@ RoleKeepawayKeeper::doMove( PlayerAgent * agent )
         Body_TurnToBall().execute( agent );
     }
 
-    agent->setNeckAction( new Neck_TurnToBallOrScan() );
+    agent->setNeckAction( new Pooled< Neck_TurnToBallOrScan >() );
 }
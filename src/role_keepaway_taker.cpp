@@ -29,6 +29,7 @@
 #endif
 
 #include "role_keepaway_taker.h"
+#include "pooled.h"
 
 
 #include <rcsc/action/body_intercept.h>
@@ -87,7 +88,7 @@ void
 RoleKeepawayTaker::doKick( PlayerAgent * agent )
 {
     Body_ClearBall().execute( agent );
-    agent->setNeckAction( new Neck_ScanField() );
+    agent->setNeckAction( new Pooled< Neck_ScanField >() );
 }
 
 /*-------------------------------------------------------------------*/
@@ -98,5 +99,5 @@ void
 RoleKeepawayTaker::doMove( PlayerAgent * agent )
 {
     Body_Intercept().execute( agent );
-    agent->setNeckAction( new Neck_TurnToBall() );
+    agent->setNeckAction( new Pooled< Neck_TurnToBall >() );
 }
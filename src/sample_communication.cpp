@@ -36,6 +36,7 @@
 #include "sample_communication.h"
 
 #include "strategy.h"
+#include "pooled.h"
 
 #include <rcsc/formation/formation.h>
 #include <rcsc/player/player_agent.h>
@@ -867,17 +868,17 @@ SampleCommunication::sayBallAndPlayers( PlayerAgent * agent )
     {
         if ( available_len >= BallPlayerMessage::slength() )
         {
-            agent->addSayMessage( new BallPlayerMessage( agent->effector().queuedNextBallPos(),
-                                                         ball_vel,
-                                                         wm.self().unum(),
-                                                         agent->effector().queuedNextSelfPos(),
-                                                         agent->effector().queuedNextSelfBody() ) );
+            agent->addSayMessage( new Pooled< BallPlayerMessage >( agent->effector().queuedNextBallPos(),
+                                                                   ball_vel,
+                                                                   wm.self().unum(),
+                                                                   agent->effector().queuedNextSelfPos(),
+                                                                   agent->effector().queuedNextSelfBody() ) );
             updatePlayerSendTime( wm, wm.ourSide(), wm.self().unum() );
         }
         else
         {
-            agent->addSayMessage( new BallMessage( agent->effector().queuedNextBallPos(),
-                                                   ball_vel ) );
+            agent->addSayMessage( new Pooled< BallMessage >( agent->effector().queuedNextBallPos(),
+                                                             ball_vel ) );
         }
         M_ball_send_time = wm.time();
         dlog.addText( Logger::COMMUNICATION,
@@ -894,10 +895,10 @@ SampleCommunication::sayBallAndPlayers( PlayerAgent * agent )
              && available_len >= BallGoalieMessage::slength() )
         {
             const PlayerObject * goalie = wm.getOpponentGoalie();
-            agent->addSayMessage( new BallGoalieMessage( agent->effector().queuedNextBallPos(),
-                                                         ball_vel,
-                                                         goalie->pos() + goalie->vel(),
-                                                         goalie->body() ) );
+            agent->addSayMessage( new Pooled< BallGoalieMessage >( agent->effector().queuedNextBallPos(),
+                                                                   ball_vel,
+                                                                   goalie->pos() + goalie->vel(),
+                                                                   goalie->body() ) );
             M_ball_send_time = wm.time();
             updatePlayerSendTime( wm, goalie->side(), goalie->unum() );
 
@@ -911,19 +912,19 @@ SampleCommunication::sayBallAndPlayers( PlayerAgent * agent )
             const AbstractPlayerObject * p0 = send_players[0].player_;
             if ( p0->unum() == wm.self().unum() )
             {
-                agent->addSayMessage( new BallPlayerMessage( agent->effector().queuedNextBallPos(),
-                                                             ball_vel,
-                                                             wm.self().unum(),
-                                                             agent->effector().queuedNextSelfPos(),
-                                                             agent->effector().queuedNextSelfBody() ) );
+                agent->addSayMessage( new Pooled< BallPlayerMessage >( agent->effector().queuedNextBallPos(),
+                                                                       ball_vel,
+                                                                       wm.self().unum(),
+                                                                       agent->effector().queuedNextSelfPos(),
+                                                                       agent->effector().queuedNextSelfBody() ) );
             }
             else
             {
-                agent->addSayMessage( new BallPlayerMessage( agent->effector().queuedNextBallPos(),
-                                                             ball_vel,
-                                                             send_players[0].number_,
-                                                             p0->pos() + p0->vel(),
-                                                             p0->body() ) );
+                agent->addSayMessage( new Pooled< BallPlayerMessage >( agent->effector().queuedNextBallPos(),
+                                                                       ball_vel,
+                                                                       send_players[0].number_,
+                                                                       p0->pos() + p0->vel(),
+                                                                       p0->body() ) );
 
             }
             M_ball_send_time = wm.time();
@@ -973,13 +974,13 @@ SampleCommunication::sayBallAndPlayers( PlayerAgent * agent )
                     Vector2D goalie_pos = goalie->pos() + goalie->vel();
                     goalie_pos.x = bound( 53.0 - 16.0, goalie_pos.x, 52.9 );
                     goalie_pos.y = bound( -19.9, goalie_pos.y, +19.9 );
-                    agent->addSayMessage( new GoalieAndPlayerMessage( goalie->unum(),
-                                                                      goalie_pos,
-                                                                      goalie->body(),
-                                                                      ( player->side() == wm.ourSide()
-                                                                        ? player->unum()
-                                                                        : player->unum() + 11 ),
-                                                                      player->pos() + player->vel() ) );
+                    agent->addSayMessage( new Pooled< GoalieAndPlayerMessage >( goalie->unum(),
+                                                                                goalie_pos,
+                                                                                goalie->body(),
+                                                                                ( player->side() == wm.ourSide()
+                                                                                  ? player->unum()
+                                                                                  : player->unum() + 11 ),
+                                                                                player->pos() + player->vel() ) );
 
                     updatePlayerSendTime( wm, goalie->side(), goalie->unum() );
                     updatePlayerSendTime( wm, player->side(), player->unum() );
@@ -1002,9 +1003,9 @@ SampleCommunication::sayBallAndPlayers( PlayerAgent * agent )
                 Vector2D goalie_pos = goalie->pos() + goalie->vel();
                 goalie_pos.x = bound( 53.0 - 16.0, goalie_pos.x, 52.9 );
                 goalie_pos.y = bound( -19.9, goalie_pos.y, +19.9 );
-                agent->addSayMessage( new GoalieMessage( goalie->unum(),
-                                                         goalie_pos,
-                                                         goalie->body() ) );
+                agent->addSayMessage( new Pooled< GoalieMessage >( goalie->unum(),
+                                                                   goalie_pos,
+                                                                   goalie->body() ) );
                 M_ball_send_time = wm.time();
                 M_opponent_send_time[goalie->unum()] = wm.time();
 
@@ -1025,12 +1026,12 @@ SampleCommunication::sayBallAndPlayers( PlayerAgent * agent )
         const AbstractPlayerObject * p0 = send_players[0].player_;
         const AbstractPlayerObject * p1 = send_players[1].player_;
         const AbstractPlayerObject * p2 = send_players[2].player_;
-        agent->addSayMessage( new ThreePlayerMessage( send_players[0].number_,
-                                                      p0->pos() + p0->vel(),
-                                                      send_players[1].number_,
-                                                      p1->pos() + p1->vel(),
-                                                      send_players[2].number_,
-                                                      p2->pos() + p2->vel() ) );
+        agent->addSayMessage( new Pooled< ThreePlayerMessage >( send_players[0].number_,
+                                                                p0->pos() + p0->vel(),
+                                                                send_players[1].number_,
+                                                                p1->pos() + p1->vel(),
+                                                                send_players[2].number_,
+                                                                p2->pos() + p2->vel() ) );
 
         updatePlayerSendTime( wm, p0->side(), p0->unum() );
         updatePlayerSendTime( wm, p1->side(), p1->unum() );
@@ -1049,10 +1050,10 @@ SampleCommunication::sayBallAndPlayers( PlayerAgent * agent )
     {
         const AbstractPlayerObject * p0 = send_players[0].player_;
         const AbstractPlayerObject * p1 = send_players[1].player_;
-        agent->addSayMessage( new TwoPlayerMessage( send_players[0].number_,
-                                                    p0->pos() + p0->vel(),
-                                                    send_players[1].number_,
-                                                    p1->pos() + p1->vel() ) );
+        agent->addSayMessage( new Pooled< TwoPlayerMessage >( send_players[0].number_,
+                                                              p0->pos() + p0->vel(),
+                                                              send_players[1].number_,
+                                                              p1->pos() + p1->vel() ) );
 
         updatePlayerSendTime( wm, p0->side(), p0->unum() );
         updatePlayerSendTime( wm, p1->side(), p1->unum() );
@@ -1078,9 +1079,9 @@ SampleCommunication::sayBallAndPlayers( PlayerAgent * agent )
             Vector2D goalie_pos = p0->pos() + p0->vel();
             goalie_pos.x = bound( 53.0 - 16.0, goalie_pos.x, 52.9 );
             goalie_pos.y = bound( -19.9, goalie_pos.y, +19.9 );
-            agent->addSayMessage( new GoalieMessage( p0->unum(),
-                                                     goalie_pos,
-                                                     p0->body() ) );
+            agent->addSayMessage( new Pooled< GoalieMessage >( p0->unum(),
+                                                               goalie_pos,
+                                                               p0->body() ) );
             updatePlayerSendTime( wm, p0->side(), p0->unum() );
 
             dlog.addText( Logger::COMMUNICATION,
@@ -1094,8 +1095,8 @@ SampleCommunication::sayBallAndPlayers( PlayerAgent * agent )
          && available_len >= OnePlayerMessage::slength() )
     {
         const AbstractPlayerObject * p0 = send_players[0].player_;
-        agent->addSayMessage( new OnePlayerMessage( send_players[0].number_,
-                                                    p0->pos() + p0->vel() ) );
+        agent->addSayMessage( new Pooled< OnePlayerMessage >( send_players[0].number_,
+                                                              p0->pos() + p0->vel() ) );
 
         updatePlayerSendTime( wm, p0->side(), p0->unum() );
 
@@ -1229,10 +1230,10 @@ SampleCommunication::sayBall( PlayerAgent * agent )
         if ( shouldSayOpponentGoalie( agent ) )
         {
             const PlayerObject * goalie = wm.getOpponentGoalie();
-            agent->addSayMessage( new BallGoalieMessage( agent->effector().queuedNextBallPos(),
-                                                         ball_vel,
-                                                         goalie->pos() + goalie->vel(),
-                                                         goalie->body() ) );
+            agent->addSayMessage( new Pooled< BallGoalieMessage >( agent->effector().queuedNextBallPos(),
+                                                                   ball_vel,
+                                                                   goalie->pos() + goalie->vel(),
+                                                                   goalie->body() ) );
             M_ball_send_time = wm.time();
             updatePlayerSendTime( wm, goalie->side(), goalie->unum() );
 
@@ -1285,11 +1286,11 @@ SampleCommunication::sayBall( PlayerAgent * agent )
             // s_last_opponent_send_time = wm.time();
             // s_last_sent_opponent_unum = opponent->unum();
 
-            agent->addSayMessage( new BallPlayerMessage( agent->effector().queuedNextBallPos(),
-                                                         ball_vel,
-                                                         opponent->unum() + 11,
-                                                         opponent->pos(),
-                                                         opponent->body() ) );
+            agent->addSayMessage( new Pooled< BallPlayerMessage >( agent->effector().queuedNextBallPos(),
+                                                                   ball_vel,
+                                                                   opponent->unum() + 11,
+                                                                   opponent->pos(),
+                                                                   opponent->body() ) );
             M_opponent_send_time[opponent->unum()] = wm.time();
 
             dlog.addText( Logger::COMMUNICATION,
@@ -1301,8 +1302,8 @@ SampleCommunication::sayBall( PlayerAgent * agent )
 
     if ( send_ball )
     {
-        agent->addSayMessage( new BallMessage( agent->effector().queuedNextBallPos(),
-                                               ball_vel ) );
+        agent->addSayMessage( new Pooled< BallMessage >( agent->effector().queuedNextBallPos(),
+                                                         ball_vel ) );
         M_ball_send_time = wm.time();
         dlog.addText( Logger::COMMUNICATION,
                       __FILE__": (sayBall) say ball only" );
@@ -1336,9 +1337,9 @@ SampleCommunication::sayGoalie( PlayerAgent * agent )
         Vector2D goalie_pos = goalie->pos() + goalie->vel();
         goalie_pos.x = bound( 53.0 - 16.0, goalie_pos.x, 52.9 );
         goalie_pos.y = bound( -19.9, goalie_pos.y, +19.9 );
-        agent->addSayMessage( new GoalieMessage( goalie->unum(),
-                                                 goalie_pos,
-                                                 goalie->body() ) );
+        agent->addSayMessage( new Pooled< GoalieMessage >( goalie->unum(),
+                                                           goalie_pos,
+                                                           goalie->body() ) );
         M_ball_send_time = wm.time();
         updatePlayerSendTime( wm, goalie->side(), goalie->unum() );
 
@@ -1403,9 +1404,9 @@ SampleCommunication::sayIntercept( PlayerAgent * agent )
          && self_min <= opp_min
          && self_min <= 10 )
     {
-        agent->addSayMessage( new InterceptMessage( true,
-                                                    wm.self().unum(),
-                                                    self_min ) );
+        agent->addSayMessage( new Pooled< InterceptMessage >( true,
+                                                              wm.self().unum(),
+                                                              self_min ) );
         dlog.addText( Logger::COMMUNICATION,
                       __FILE__": say self intercept info %d",
                       self_min );
@@ -1470,7 +1471,7 @@ SampleCommunication::sayOffsideLine( PlayerAgent * agent )
          && std::fabs( wm.self().pos().x - wm.offsideLineX() ) < 20.0
          )
     {
-        agent->addSayMessage( new OffsideLineMessage( wm.offsideLineX() ) );
+        agent->addSayMessage( new Pooled< OffsideLineMessage >( wm.offsideLineX() ) );
         dlog.addText( Logger::COMMUNICATION,
                       __FILE__": say offside line %.1f",
                       wm.offsideLineX() );
@@ -1517,7 +1518,7 @@ SampleCommunication::sayDefenseLine( PlayerAgent * agent )
          && opp_trap_pos.x < -20.0
          && wm.time().cycle() % 3 == 0 )
     {
-        agent->addSayMessage( new DefenseLineMessage( wm.ourDefenseLineX() ) );
+        agent->addSayMessage( new Pooled< DefenseLineMessage >( wm.ourDefenseLineX() ) );
         dlog.addText( Logger::COMMUNICATION,
                       __FILE__": say defense line %.1f",
                       wm.ourDefenseLineX() );
@@ -1753,12 +1754,12 @@ SampleCommunication::sayPlayers( PlayerAgent * agent )
                            ? (*third)->unum()
                            : (*third)->unum() + 11 );
 
-        agent->addSayMessage( new ThreePlayerMessage( first_unum,
-                                                      (*first)->pos() + (*first)->vel(),
-                                                      second_unum,
-                                                      (*second)->pos() + (*second)->vel(),
-                                                      third_unum,
-                                                      (*third)->pos() + (*third)->vel() ) );
+        agent->addSayMessage( new Pooled< ThreePlayerMessage >( first_unum,
+                                                                (*first)->pos() + (*first)->vel(),
+                                                                second_unum,
+                                                                (*second)->pos() + (*second)->vel(),
+                                                                third_unum,
+                                                                (*third)->pos() + (*third)->vel() ) );
         updatePlayerSendTime( wm, (*first)->side(), (*first)->unum() );
         updatePlayerSendTime( wm, (*second)->side(), (*second)->unum() );
         updatePlayerSendTime( wm, (*third)->side(), (*third)->unum() );
@@ -1776,10 +1777,10 @@ SampleCommunication::sayPlayers( PlayerAgent * agent )
         int second_unum = ( (*second)->side() == wm.ourSide()
                             ? (*second)->unum()
                             : (*second)->unum() + 11 );
-        agent->addSayMessage( new TwoPlayerMessage( first_unum,
-                                                    (*first)->pos() + (*first)->vel(),
-                                                    second_unum,
-                                                    (*second)->pos() + (*second)->vel() ) );
+        agent->addSayMessage( new Pooled< TwoPlayerMessage >( first_unum,
+                                                              (*first)->pos() + (*first)->vel(),
+                                                              second_unum,
+                                                              (*second)->pos() + (*second)->vel() ) );
         updatePlayerSendTime( wm, (*first)->side(), (*first)->unum() );
         updatePlayerSendTime( wm, (*second)->side(), (*second)->unum() );
 
@@ -1790,8 +1791,8 @@ SampleCommunication::sayPlayers( PlayerAgent * agent )
     }
     else if ( len + OnePlayerMessage::slength() <= ServerParam::i().playerSayMsgSize() )
     {
-        agent->addSayMessage( new OnePlayerMessage( first_unum,
-                                                    (*first)->pos() + (*first)->vel() ) );
+        agent->addSayMessage( new Pooled< OnePlayerMessage >( first_unum,
+                                                              (*first)->pos() + (*first)->vel() ) );
         updatePlayerSendTime( wm, (*first)->side(), (*first)->unum() );
 
         dlog.addText( Logger::COMMUNICATION,
@@ -1848,9 +1849,9 @@ SampleCommunication::sayOpponents( PlayerAgent * agent )
          && 10.0 < fastest_opponent->distFromSelf()
          && fastest_opponent->distFromSelf() < 30.0 )
     {
-        agent->addSayMessage( new OpponentMessage( fastest_opponent->unum(),
-                                                   fastest_opponent->pos(),
-                                                   fastest_opponent->body() ) );
+        agent->addSayMessage( new Pooled< OpponentMessage >( fastest_opponent->unum(),
+                                                             fastest_opponent->pos(),
+                                                             fastest_opponent->body() ) );
         M_opponent_send_time[fastest_opponent->unum()] = wm.time();
 
         dlog.addText( Logger::COMMUNICATION,
@@ -1903,10 +1904,10 @@ SampleCommunication::sayTwoOpponents( PlayerAgent * agent )
     std::vector< const PlayerObject * >::const_iterator first = candidates.begin();
     std::vector< const PlayerObject * >::const_iterator second = first; ++second;
 
-    agent->addSayMessage( new TwoPlayerMessage( (*first)->unum() + 11,
-                                                (*first)->pos() + (*first)->vel(),
-                                                (*second)->unum() + 11,
-                                                (*second)->pos() + (*second)->vel() ) );
+    agent->addSayMessage( new Pooled< TwoPlayerMessage >( (*first)->unum() + 11,
+                                                          (*first)->pos() + (*first)->vel(),
+                                                          (*second)->unum() + 11,
+                                                          (*second)->pos() + (*second)->vel() ) );
     M_opponent_send_time[(*first)->unum()] = wm.time();
     M_opponent_send_time[(*second)->unum()] = wm.time();
 
@@ -1961,12 +1962,12 @@ SampleCommunication::sayThreeOpponents( PlayerAgent * agent )
     std::vector< const PlayerObject * >::const_iterator second = first; ++second;
     std::vector< const PlayerObject * >::const_iterator third = second; ++third;
 
-    agent->addSayMessage( new ThreePlayerMessage( (*first)->unum() + 11,
-                                                  (*first)->pos() + (*first)->vel(),
-                                                  (*second)->unum() + 11,
-                                                  (*second)->pos() + (*second)->vel(),
-                                                  (*third)->unum() + 11,
-                                                  (*third)->pos() + (*third)->vel() ) );
+    agent->addSayMessage( new Pooled< ThreePlayerMessage >( (*first)->unum() + 11,
+                                                            (*first)->pos() + (*first)->vel(),
+                                                            (*second)->unum() + 11,
+                                                            (*second)->pos() + (*second)->vel(),
+                                                            (*third)->unum() + 11,
+                                                            (*third)->pos() + (*third)->vel() ) );
     M_opponent_send_time[(*first)->unum()] = wm.time();
     M_opponent_send_time[(*second)->unum()] = wm.time();
     M_opponent_send_time[(*third)->unum()] = wm.time();
@@ -2076,9 +2077,9 @@ SampleCommunication::saySelf( PlayerAgent * agent )
 
     if ( send_self )
     {
-        agent->addSayMessage( new SelfMessage( agent->effector().queuedNextMyPos(),
-                                               agent->effector().queuedNextMyBody(),
-                                               wm.self().stamina() ) );
+        agent->addSayMessage( new Pooled< SelfMessage >( agent->effector().queuedNextMyPos(),
+                                                         agent->effector().queuedNextMyBody(),
+                                                         wm.self().stamina() ) );
         M_teammate_send_time[wm.self().unum()] = wm.time();
 
         dlog.addText( Logger::COMMUNICATION,
@@ -2108,7 +2109,7 @@ SampleCommunication::sayStamina( PlayerAgent * agent )
         return false;
     }
 
-    agent->addSayMessage( new StaminaMessage( agent->world().self().stamina() ) );
+    agent->addSayMessage( new Pooled< StaminaMessage >( agent->world().self().stamina() ) );
 
     dlog.addText( Logger::COMMUNICATION,
                   __FILE__": say self stamina" );
@@ -2129,7 +2130,7 @@ SampleCommunication::sayRecovery( PlayerAgent * agent )
         return false;
     }
 
-    agent->addSayMessage( new RecoveryMessage( agent->world().self().recovery() ) );
+    agent->addSayMessage( new Pooled< RecoveryMessage >( agent->world().self().recovery() ) );
 
     dlog.addText( Logger::COMMUNICATION,
                   __FILE__": say self recovery" );
@@ -191,7 +191,7 @@ evaluate_state( const PredictState & state )
     if ( FieldAnalyzer::can_shoot_from
          ( holder->unum() == state.self().unum(),
            holder->pos(),
-           state.getPlayerCont( new OpponentOrUnknownPlayerPredicate( state.ourSide() ) ),
+           state.opponentsOrUnknown(),
            VALID_PLAYER_THRESHOLD ) )
     {
         point += 1.0e+6;
@@ -35,6 +35,7 @@
 #include "field_analyzer.h"
 
 #include "action_chain_holder.h"
+#include "ball_travel_table.h"
 #include "sample_field_evaluator.h"
 
 #include "soccer_role.h"
@@ -53,6 +54,7 @@
 #include "view_tactical.h"
 
 #include "intention_receive.h"
+#include "pooled.h"
 #include "lowlevel_feature_extractor.h"
 #include "highlevel_feature_extractor.h"
 
@@ -499,6 +501,13 @@ SamplePlayer::handleServerParam()
         M_client->setServerAlive( false );
     }
 
+    if ( ! BallTravelTable::instance().createTables() )
+    {
+        std::cerr << world().teamName() << ' '
+                  << world().self().unum() << ": "
+                  << " BallTravelTable failed. use direct calculation."
+                  << std::endl;
+    }
 
     if ( ServerParam::i().keepawayMode() )
     {
@@ -567,8 +576,8 @@ SamplePlayer::doPreprocess()
                       __FILE__": tackle wait. expires= %d",
                       wm.self().tackleExpires() );
         // face neck to ball
-        this->setViewAction( new View_Tactical() );
-        this->setNeckAction( new Neck_TurnToBallOrScan() );
+        this->setViewAction( new Pooled< View_Tactical >() );
+        this->setNeckAction( new Pooled< Neck_TurnToBallOrScan >() );
         return true;
     }
 
@@ -582,7 +591,7 @@ SamplePlayer::doPreprocess()
                       __FILE__": before_kick_off" );
         Vector2D move_point =  Strategy::i().getPosition( wm.self().unum() );
         Bhv_CustomBeforeKickOff( move_point ).execute( this );
-        this->setViewAction( new View_Tactical() );
+        this->setViewAction( new Pooled< View_Tactical >() );
         return true;
     }
 
@@ -609,7 +618,7 @@ SamplePlayer::doPreprocess()
     {
         dlog.addText( Logger::TEAM,
                       __FILE__": search ball" );
-        this->setViewAction( new View_Tactical() );
+        this->setViewAction( new Pooled< View_Tactical >() );
         Bhv_NeckBodyToBall().execute( this );
         return true;
     }
@@ -618,7 +627,7 @@ SamplePlayer::doPreprocess()
     // set default change view
     //
 
-    this->setViewAction( new View_Tactical() );
+    this->setViewAction( new Pooled< View_Tactical >() );
 
     //
     // check shoot chance
@@ -711,7 +720,7 @@ SamplePlayer::doForceKick()
         Body_KickOneStep( goal_pos,
                           ServerParam::i().ballSpeedMax()
                           ).execute( this );
-        this->setNeckAction( new Neck_ScanField() );
+        this->setNeckAction( new Pooled< Neck_ScanField >() );
         return true;
     }
 
@@ -756,7 +765,7 @@ SamplePlayer::doHeardPassReceive()
                       self_min );
         this->debugClient().addMessage( "Comm:Receive:Intercept" );
         Body_Intercept().execute( this );
-        this->setNeckAction( new Neck_TurnToBall() );
+        this->setNeckAction( new Pooled< Neck_TurnToBall >() );
     }
     else
     {
@@ -769,14 +778,14 @@ SamplePlayer::doHeardPassReceive()
                     0.5,
                         ServerParam::i().maxDashPower()
                         ).execute( this );
-        this->setNeckAction( new Neck_TurnToBall() );
+        this->setNeckAction( new Pooled< Neck_TurnToBall >() );
     }
 
-    this->setIntention( new IntentionReceive( heard_pos,
-                                              ServerParam::i().maxDashPower(),
-                                              0.9,
-                                              5,
-                                              wm.time() ) );
+    this->setIntention( new Pooled< IntentionReceive >( heard_pos,
+                                                        ServerParam::i().maxDashPower(),
+                                                        0.9,
+                                                        5,
+                                                        wm.time() ) );
 
     return true;
 }
@@ -813,6 +822,7 @@ SamplePlayer::createFieldEvaluator() const
 #include "actgen_simple_dribble.h"
 #include "actgen_shoot.h"
 #include "actgen_action_chain_length_filter.h"
+#include "actgen_profile.h"
 
 ActionGenerator::ConstPtr
 SamplePlayer::createActionGenerator() const
@@ -823,20 +833,20 @@ SamplePlayer::createActionGenerator() const
     // shoot
     //
     g->addGenerator( new ActGen_RangeActionChainLengthFilter
-                     ( new ActGen_Shoot(),
+                     ( new ActGen_Profile( "Shoot", new ActGen_Shoot() ),
                        2, ActGen_RangeActionChainLengthFilter::MAX ) );
 
     //
     // strict check pass
     //
     g->addGenerator( new ActGen_MaxActionChainLengthFilter
-                     ( new ActGen_StrictCheckPass(), 1 ) );
+                     ( new ActGen_Profile( "StrictCheckPass", new ActGen_StrictCheckPass() ), 1 ) );
 
     //
     // cross
     //
     g->addGenerator( new ActGen_MaxActionChainLengthFilter
-                     ( new ActGen_Cross(), 1 ) );
+                     ( new ActGen_Profile( "Cross", new ActGen_Cross() ), 1 ) );
 
     //
     // direct pass
@@ -849,13 +859,13 @@ SamplePlayer::createActionGenerator() const
     // short dribble
     //
     g->addGenerator( new ActGen_MaxActionChainLengthFilter
-                     ( new ActGen_ShortDribble(), 1 ) );
+                     ( new ActGen_Profile( "ShortDribble", new ActGen_ShortDribble() ), 1 ) );
 
     //
     // self pass (long dribble)
     //
     g->addGenerator( new ActGen_MaxActionChainLengthFilter
-                     ( new ActGen_SelfPass(), 1 ) );
+                     ( new ActGen_Profile( "SelfPass", new ActGen_SelfPass() ), 1 ) );
 
     //
     // simple dribble
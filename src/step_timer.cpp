@@ -0,0 +1,116 @@
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "step_timer.h"
+#include <chrono>
+
+LatencyHistogram::LatencyHistogram() :
+  counts(OVERFLOW_BUCKET + 1, 0)
+{
+  reset();
+}
+
+int LatencyHistogram::bucketIndex(uint64_t nsec) {
+  if (nsec < (uint64_t) SUB_BUCKETS) {
+    return nsec;
+  }
+  // Keep the log2(SUB_BUCKETS) most significant bits
+  int msb = 63 - __builtin_clzll(nsec);
+  int shift = msb - __builtin_ctz(SUB_BUCKETS) + 1;
+  if (shift > MAX_SHIFT) {
+    return OVERFLOW_BUCKET;
+  }
+  return shift * (SUB_BUCKETS / 2) + (nsec >> shift);
+}
+
+double LatencyHistogram::bucketValue(int index) {
+  if (index < SUB_BUCKETS) {
+    return index / 1000.0;
+  }
+  int shift = index / (SUB_BUCKETS / 2) - 1;
+  uint64_t low = (uint64_t) (index - shift * (SUB_BUCKETS / 2)) << shift;
+  return (low + (((uint64_t) 1 << shift) - 1) / 2.0) / 1000.0;
+}
+
+void LatencyHistogram::add(double usec) {
+  if (usec < 0) {
+    usec = 0;
+  }
+  // Beyond 2^63ns, the conversion would overflow; all land in the overflow
+  // bucket
+  const double nsec = usec * 1000.0;
+  counts[bucketIndex(nsec < 9.2e18 ? (uint64_t) nsec : (uint64_t) 1 << 63)]++;
+  if (numSamples == 0 || usec < minUsec) {
+    minUsec = usec;
+  }
+  if (usec > maxUsec) {
+    maxUsec = usec;
+  }
+  totalUsec += usec;
+  numSamples++;
+}
+
+void LatencyHistogram::reset() {
+  counts.assign(counts.size(), 0);
+  numSamples = 0;
+  totalUsec = 0;
+  minUsec = 0;
+  maxUsec = 0;
+}
+
+double LatencyHistogram::percentile(double p) const {
+  if (numSamples == 0) {
+    return 0;
+  }
+  // Rank of the sample, counted from 1
+  unsigned long rank = (unsigned long) (p * numSamples + 0.5);
+  if (rank < 1) {
+    rank = 1;
+  }
+  unsigned long seen = 0;
+  for (size_t i = 0; i < counts.size(); ++i) {
+    seen += counts[i];
+    if (seen >= rank) {
+      if (i == OVERFLOW_BUCKET) {
+        return maxUsec; // Beyond the range of the buckets
+      }
+      double value = bucketValue(i);
+      return value < minUsec ? minUsec : (value > maxUsec ? maxUsec : value);
+    }
+  }
+  return maxUsec;
+}
+
+StepTimer::StepTimer() {}
+
+double StepTimer::now() {
+  return std::chrono::duration<double, std::micro>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void StepTimer::reset() {
+  for (int i = 0; i < NUM_PHASES; ++i) {
+    histograms[i].reset();
+  }
+}
+
+void StepTimer::getStats(std::vector<hfo::TimingStats>* stats) const {
+  static const char* names[NUM_PHASES] = {
+    "connect", "step", "execute", "receive", "trainer", "pre_action"
+  };
+  stats->resize(NUM_PHASES);
+  for (int i = 0; i < NUM_PHASES; ++i) {
+    const LatencyHistogram& h = histograms[i];
+    hfo::TimingStats& s = (*stats)[i];
+    s.name = names[i];
+    s.count = h.count();
+    s.total_usec = h.total();
+    s.min_usec = h.min();
+    s.max_usec = h.max();
+    s.p50_usec = h.percentile(0.5);
+    s.p90_usec = h.percentile(0.9);
+    s.p99_usec = h.percentile(0.99);
+    s.p999_usec = h.percentile(0.999);
+  }
+}
@@ -0,0 +1,77 @@
+// -*-c++-*-
+
+#ifndef STEP_TIMER_H
+#define STEP_TIMER_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "common.hpp"
+
+/**
+ * Histogram of latencies with logarithmic buckets, each split into
+ * linear sub-buckets (as in HdrHistogram), so that any recorded value is
+ * reproduced within 1/SUB_BUCKETS of itself. Values are recorded in
+ * nanoseconds, from 1ns to about 18 minutes; longer ones are counted in
+ * a separate overflow bucket, reported as the maximum.
+ */
+class LatencyHistogram {
+public:
+  LatencyHistogram();
+
+  void add(double usec);
+  void reset();
+
+  inline unsigned long count() const { return numSamples; }
+  inline double total() const { return totalUsec; }
+  inline double min() const { return numSamples ? minUsec : 0; }
+  inline double max() const { return maxUsec; }
+  // Value below which fraction p of the samples fall, 0 <= p <= 1
+  double percentile(double p) const;
+
+private:
+  static const int SUB_BUCKETS = 32;
+  static const int MAX_SHIFT = 35;
+  // One past the last real bucket, (MAX_SHIFT, SUB_BUCKETS - 1)
+  static const int OVERFLOW_BUCKET = (MAX_SHIFT + 2) * (SUB_BUCKETS / 2);
+
+  static int bucketIndex(uint64_t nsec);
+  static double bucketValue(int index); // middle of the bucket, in usec
+
+  std::vector<unsigned long> counts;
+  unsigned long numSamples;
+  double totalUsec, minUsec, maxUsec;
+};
+
+/**
+ * Latency histograms of the phases of HFOEnvironment::connectToServer()
+ * and HFOEnvironment::step().
+ */
+class StepTimer {
+public:
+  enum Phase {
+    CONNECT,    // Whole connectToServer()
+    STEP,       // Whole step(); the NOOPs after an episode are steps themselves
+    EXECUTE,    // Executing the action, per cycle
+    RECEIVE,    // BasicClient::runStep: waiting for and parsing server messages, per cycle
+    TRAINER,    // Processing trainer messages, per cycle
+    PRE_ACTION, // World model update, features and reward, per cycle
+    NUM_PHASES
+  };
+
+  StepTimer();
+
+  // Monotonic time in microseconds
+  static double now();
+
+  inline void add(Phase phase, double usec) { histograms[phase].add(usec); }
+  void reset();
+
+  // One entry per phase
+  void getStats(std::vector<hfo::TimingStats>* stats) const;
+
+private:
+  LatencyHistogram histograms[NUM_PHASES];
+};
+
+#endif // STEP_TIMER_H
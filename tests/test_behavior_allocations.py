@@ -0,0 +1,119 @@
+"""Per-cycle behavior objects come from the pools: every view, neck,
+intention and say message handed to the agent is a Pooled< T >, and
+steady-state stepping takes at most a few blocks from the heap"""
+from __future__ import print_function
+
+import glob
+import os
+import re
+import subprocess
+import sys
+import time
+
+import hfo
+
+hfo_env = hfo.HFOEnvironment()
+
+# Warm up until no block was taken for STABLE_STEPS steps in a row
+STABLE_STEPS = 100
+MAX_WARMUP_STEPS = 2000
+MEASURED_STEPS = 500
+# Paths first reached after the warm-up (set plays, a new episode
+# situation) may still fill a few blocks, so the steady state is allowed
+# up to MAX_STEADY_BLOCKS rather than none
+MAX_STEADY_BLOCKS = 8
+
+# The pool counter only sees Pooled< T > allocations; a plain "new T" at
+# these call sites bypasses it, so they are checked in the sources
+POOLED_CALLS = re.compile(r'\b(setNeckAction|setViewAction|setIntention|addSayMessage)'
+                          r'\s*\(\s*new\s+(?!Pooled\s*<)([\w:]+)')
+
+def strip_comments(source):
+    source = re.sub(r'/\*.*?\*/', lambda m: '\n' * m.group().count('\n'),
+                    source, flags=re.S)
+    return re.sub(r'//[^\n]*', '', source)
+
+def test_pooled_call_sites():
+    test_dir = os.path.dirname(os.path.abspath(os.path.realpath(__file__)))
+    src_dir = os.path.normpath(test_dir + "/../src")
+    unpooled = []
+    for path in sorted(glob.glob(os.path.join(src_dir, '*.cpp')) +
+                       glob.glob(os.path.join(src_dir, '*', '*.cpp'))):
+        with open(path, 'rb') as f:
+            source = strip_comments(f.read().decode('utf-8', 'replace'))
+        for match in POOLED_CALLS.finditer(source):
+            line = source.count('\n', 0, match.start()) + 1
+            unpooled.append("{!s}:{!s}: {!s}( new {!s} )".format(
+                os.path.relpath(path, src_dir), line, match.group(1), match.group(2)))
+    assert (not unpooled), ("Not allocated from the pools:\n" + "\n".join(unpooled))
+
+def act_and_step():
+    state = hfo_env.getState()
+    if int(state[5]) == 1: # has the ball
+        hfo_env.act(hfo.DRIBBLE)
+    else:
+        hfo_env.act(hfo.MOVE)
+    status = hfo_env.step()
+    assert (status != hfo.SERVER_DOWN), "Server went down"
+
+def test_behavior_allocations():
+    if sys.platform == 'darwin':
+        print("Pools are disabled on macOS, skipping")
+        return
+    test_dir   = os.path.dirname(os.path.abspath(os.path.realpath(__file__)))
+    binary_dir = os.path.normpath(test_dir + "/../bin")
+    conf_dir = os.path.join(binary_dir, 'teams/base/config/formations-dt')
+    bin_HFO = os.path.join(binary_dir, "HFO")
+
+    popen_list = [sys.executable, "-x", bin_HFO,
+                  "--offense-agents=1", "--defense-npcs=1",
+                  "--headless"]
+
+    HFO_process = subprocess.Popen(popen_list)
+
+    time.sleep(0.2)
+
+    assert (HFO_process.poll() is
+            None), "Failed to start HFO with command '{}'".format(" ".join(popen_list))
+
+    time.sleep(3)
+
+    try:
+        hfo_env.connectToServer(hfo.HIGH_LEVEL_FEATURE_SET, config_dir=conf_dir)
+
+        # Fill the pools, over several episodes
+        allocations = hfo_env.getBehaviorAllocations()
+        stable = 0
+        for x in range(MAX_WARMUP_STEPS):
+            act_and_step()
+            count = hfo_env.getBehaviorAllocations()
+            stable = stable + 1 if count == allocations else 0
+            allocations = count
+            if stable >= STABLE_STEPS:
+                break
+
+        print("Pools took {!s} blocks while warming up".format(allocations))
+        assert (allocations > 0), "Behavior objects are not pooled"
+        assert (stable >= STABLE_STEPS), ("Pools still took blocks after {!s} steps".
+                                          format(MAX_WARMUP_STEPS))
+
+        for x in range(MEASURED_STEPS):
+            act_and_step()
+
+        steady = hfo_env.getBehaviorAllocations() - allocations
+        assert (steady <= MAX_STEADY_BLOCKS), ("Pools took {!s} more blocks in the steady state".
+                                              format(steady))
+
+        HFO_process.terminate()
+        hfo_env.act(hfo.QUIT)
+        time.sleep(1.2)
+        hfo_env.step()
+
+    finally:
+        if HFO_process.poll() is None:
+            HFO_process.terminate()
+        os.system("killall -9 rcssserver")
+
+if __name__ == '__main__':
+    test_pooled_call_sites()
+    test_behavior_allocations()
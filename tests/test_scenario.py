@@ -0,0 +1,109 @@
+"""Tests of scenario files and curricula, only of functions available sans server"""
+from __future__ import print_function
+
+import math
+import os
+import re
+import sys
+
+test_dir = os.path.dirname(os.path.abspath(os.path.realpath(__file__)))
+sys.path.insert(0, os.path.normpath(test_dir + "/../bin"))
+
+from Scenario import Curriculum, PITCH_HALF_LENGTH, PITCH_HALF_WIDTH, POSSESSION_DIST
+
+EXAMPLE = os.path.normpath(test_dir + "/../example/curriculum_1v1.json")
+OFFENSE = ('base_left', [7])
+DEFENSE = ('base_right', [1])
+TOLERANCE = 1e-4
+
+MOVE = re.compile(r'\(move \((player \S+ \d+|ball)\) ([^\s)]+) ([^\s)]+)')
+
+def moves(cmds):
+    """ Maps each moved object to its (x, y) """
+    places = {}
+    for cmd in cmds:
+        match = MOVE.match(cmd)
+        if match:
+            places[match.group(1)] = (float(match.group(2)), float(match.group(3)))
+    return places
+
+def test_ranges():
+    curriculum = Curriculum(EXAMPLE, seed=1)
+    scenario = curriculum._scenarios['open_goal']
+    xs = []
+    for trial in range(200):
+        cmds = curriculum.commands(scenario, OFFENSE, DEFENSE)
+        x, y = moves(cmds)['player base_left 7']
+        assert (0.6 * PITCH_HALF_LENGTH - TOLERANCE <= x <=
+                0.8 * PITCH_HALF_LENGTH + TOLERANCE), "x {!s} out of its range".format(x)
+        assert (abs(y) <= 0.2 * PITCH_HALF_WIDTH + TOLERANCE), "y {!s} out of its range".format(y)
+        # Fixed numbers are not drawn
+        assert (moves(cmds)['player base_right 1'] ==
+                (round(0.3 * PITCH_HALF_LENGTH, 6), round(0.9 * PITCH_HALF_WIDTH, 6)))
+        assert ('(recover)' in cmds), "recover is not applied"
+        xs.append(x)
+    assert (max(xs) - min(xs) > 0.1 * PITCH_HALF_LENGTH), "Ranges are not sampled"
+
+def test_seed():
+    draw = lambda: [curriculum.commands(curriculum.nextScenario(), OFFENSE, DEFENSE)
+                    for trial in range(20)]
+    curriculum = Curriculum(EXAMPLE, seed=7)
+    first = draw()
+    curriculum = Curriculum(EXAMPLE, seed=7)
+    assert (draw() == first), "The same seed draws different trials"
+
+def test_possession():
+    curriculum = Curriculum(EXAMPLE, seed=2)
+    scenario = curriculum._scenarios['goalie_in_goal']
+    for trial in range(20):
+        places = moves(curriculum.commands(scenario, OFFENSE, DEFENSE))
+        px, py = places['player base_left 7']
+        bx, by = places['ball']
+        # body is 0, so the ball is straight ahead of the player, at rest
+        assert (abs(bx - (px + POSSESSION_DIST)) < TOLERANCE and
+                abs(by - py) < TOLERANCE), "Ball {!s} not in front of {!s}".format(
+                    (bx, by), (px, py))
+    cmds = curriculum.commands(scenario, OFFENSE, DEFENSE)
+    ball = [cmd for cmd in cmds if cmd.startswith('(move (ball)')][0]
+    assert (ball.endswith(' 0 0.000000 0.000000)')), "The ball is not at rest: " + ball
+
+def test_stage_by_trials():
+    curriculum = Curriculum(EXAMPLE, seed=3)
+    # No goals, so the first stage lasts its 200 trials
+    for trial in range(199):
+        assert (not curriculum.endTrial(False))
+        assert (curriculum.nextScenario().name() == 'open_goal')
+    assert (curriculum.endTrial(False)), "The stage did not end after its trials"
+    assert (curriculum.stage() == 1)
+    names = set(curriculum.nextScenario().name() for trial in range(100))
+    assert (names == set(['open_goal', 'goalie_in_goal'])), names
+    for trial in range(499):
+        assert (not curriculum.endTrial(True))
+    assert (curriculum.endTrial(True))
+    # The last stage never ends
+    assert (curriculum.stage() == 2)
+    for trial in range(1000):
+        assert (not curriculum.endTrial(True))
+    assert (curriculum.stage() == 2)
+
+def test_stage_by_goal_rate():
+    curriculum = Curriculum(EXAMPLE, seed=4)
+    # goal_rate 0.9 over a window of 50: not before 50 trials
+    for trial in range(49):
+        assert (not curriculum.endTrial(True))
+    assert (curriculum.endTrial(True)), "The stage did not end on its goal rate"
+    assert (curriculum.stage() == 1)
+
+    # 45 goals in the last 50 trials reach the rate, 44 do not
+    curriculum = Curriculum(EXAMPLE, seed=4)
+    outcomes = [False] * 20 + [True] * 44 + [False] * 5
+    for goal in outcomes:
+        assert (not curriculum.endTrial(goal))
+    assert (curriculum.endTrial(True)), "45 goals in 50 trials did not end the stage"
+
+if __name__ == '__main__':
+    test_ranges()
+    test_seed()
+    test_possession()
+    test_stage_by_trials()
+    test_stage_by_goal_rate()
@@ -0,0 +1,75 @@
+"""Restoring a saved game state must bring the game back to it"""
+from __future__ import print_function
+
+import os
+import subprocess
+import sys
+import time
+
+import hfo
+
+hfo_env = hfo.HFOEnvironment()
+
+# Normalized feature units; the agent walks much farther than this
+TOLERANCE = 0.1
+
+def test_state_snapshot():
+    test_dir   = os.path.dirname(os.path.abspath(os.path.realpath(__file__)))
+    binary_dir = os.path.normpath(test_dir + "/../bin")
+    conf_dir = os.path.join(binary_dir, 'teams/base/config/formations-dt')
+    bin_HFO = os.path.join(binary_dir, "HFO")
+
+    popen_list = [sys.executable, "-x", bin_HFO,
+                  "--offense-agents=1", "--defense-npcs=1",
+                  "--untouched-time=1000", "--headless"]
+
+    HFO_process = subprocess.Popen(popen_list)
+
+    time.sleep(0.2)
+
+    assert (HFO_process.poll() is
+            None), "Failed to start HFO with command '{}'".format(" ".join(popen_list))
+
+    time.sleep(3)
+
+    try:
+        hfo_env.connectToServer(hfo.HIGH_LEVEL_FEATURE_SET, config_dir=conf_dir)
+
+        for x in range(10):
+            hfo_env.act(hfo.NOOP)
+            hfo_env.step()
+
+        snapshot_id = hfo_env.saveState()
+        assert (snapshot_id >= 0), "The trainer did not save the state"
+        saved = hfo_env.getState()[:2] # Position of the agent
+
+        for x in range(20):
+            hfo_env.act(hfo.DASH, 100, 0)
+            hfo_env.step()
+        moved = hfo_env.getState()[:2]
+        assert (abs(moved[0] - saved[0]) > TOLERANCE), "The agent did not move"
+
+        assert hfo_env.restoreState(snapshot_id), "The trainer did not restore the state"
+        restored = hfo_env.getState()[:2]
+        print("Saved {!s}, moved to {!s}, restored {!s}".format(saved, moved, restored))
+        for i in range(2):
+            assert (abs(restored[i] - saved[i]) <
+                    TOLERANCE), "The agent is not back at its saved position"
+
+        assert not hfo_env.restoreState(snapshot_id + 1), "Restored an unknown snapshot"
+
+        assert hfo_env.dropState(snapshot_id), "The trainer did not drop the snapshot"
+        assert not hfo_env.restoreState(snapshot_id), "Restored a dropped snapshot"
+
+        HFO_process.terminate()
+        hfo_env.act(hfo.QUIT)
+        time.sleep(1.2)
+        hfo_env.step()
+
+    finally:
+        if HFO_process.poll() is None:
+            HFO_process.terminate()
+        os.system("killall -9 rcssserver")
+
+if __name__ == '__main__':
+    test_state_snapshot()